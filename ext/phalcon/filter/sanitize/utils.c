@@ -0,0 +1,109 @@
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "php.h"
+#include "php_phalcon.h"
+
+#include "phalcon/filter/sanitize/utils.h"
+
+#define PHALCON_FILTER_ALPHA 1
+#define PHALCON_FILTER_DIGIT 2
+
+/* Class of every byte: ASCII letters are 1, ASCII digits are 2 */
+static const unsigned char phalcon_filter_classes[256] = {
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0,
+	0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0,
+	0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+
+/**
+ * Keeps the bytes of a string whose class matches the mask. Strings that are
+ * already clean are returned as they are, without a copy
+ */
+static void phalcon_filter_keep(zval *return_value, zval *param, unsigned char mask)
+{
+	const unsigned char *cursor, *end, *source;
+	unsigned char *target;
+	zend_string *filtered;
+
+	if (Z_TYPE_P(param) != IS_STRING) {
+		RETURN_EMPTY_STRING();
+	}
+
+	source = (const unsigned char *) Z_STRVAL_P(param);
+	end    = source + Z_STRLEN_P(param);
+	cursor = source;
+
+	while (cursor < end && (phalcon_filter_classes[*cursor] & mask)) {
+		cursor++;
+	}
+
+	if (cursor == end) {
+		RETURN_STR_COPY(Z_STR_P(param));
+	}
+
+	/* At least one byte is removed */
+	filtered = zend_string_alloc(Z_STRLEN_P(param) - 1, 0);
+	target   = (unsigned char *) ZSTR_VAL(filtered);
+
+	memcpy(target, source, cursor - source);
+	target += cursor - source;
+
+	for (cursor++; cursor < end; cursor++) {
+		if (phalcon_filter_classes[*cursor] & mask) {
+			*target++ = *cursor;
+		}
+	}
+
+	if (target == (unsigned char *) ZSTR_VAL(filtered)) {
+		zend_string_free(filtered);
+		RETURN_EMPTY_STRING();
+	}
+
+	*target = '\0';
+	ZSTR_LEN(filtered) = target - (unsigned char *) ZSTR_VAL(filtered);
+
+	RETURN_NEW_STR(filtered);
+}
+
+/**
+ * Removes every byte which is not an ASCII letter or digit, as
+ * preg_replace("/[^A-Za-z0-9]/", "", param) does
+ */
+void phalcon_filter_alnum(zval *return_value, zval *param)
+{
+	phalcon_filter_keep(return_value, param, PHALCON_FILTER_ALPHA | PHALCON_FILTER_DIGIT);
+}
+
+/**
+ * Removes every byte which is not an ASCII letter, as
+ * preg_replace("/[^A-Za-z]/", "", param) does
+ */
+void phalcon_filter_alpha(zval *return_value, zval *param)
+{
+	phalcon_filter_keep(return_value, param, PHALCON_FILTER_ALPHA);
+}
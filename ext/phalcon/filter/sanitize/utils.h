@@ -0,0 +1,20 @@
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+#ifndef PHALCON_FILTER_SANITIZE_UTILS_H
+#define PHALCON_FILTER_SANITIZE_UTILS_H
+
+#include <Zend/zend.h>
+
+/* Table driven sanitizers of strings */
+void phalcon_filter_alnum(zval *return_value, zval *param);
+void phalcon_filter_alpha(zval *return_value, zval *param);
+
+#endif /* PHALCON_FILTER_SANITIZE_UTILS_H */
@@ -100,6 +100,14 @@ class Memory extends AbstractAdapter
      */
     protected accessList;
 
+    /**
+     * Access keys granting or denying each role, component and access,
+     * resolved through the inherited roles and the wildcards
+     *
+     * @var array
+     */
+    protected accessKeys = [];
+
     /**
      * Returns latest function used to acquire access
      *
@@ -142,6 +150,21 @@ class Memory extends AbstractAdapter
      */
     protected func;
 
+    /**
+     * Parameters of the functions, read once with reflection
+     *
+     * @var array
+     */
+    protected funcParameters = [];
+
+    /**
+     * Every role inherited by a role, directly or not, in the order they are
+     * checked
+     *
+     * @var array
+     */
+    protected inheritedRoles = [];
+
     /**
      * Default action for no arguments is allow
      *
@@ -381,6 +404,9 @@ class Memory extends AbstractAdapter
             let this->roleInherits[roleName][] = roleInheritName;
         }
 
+        let this->accessKeys     = [],
+            this->inheritedRoles = [];
+
         return true;
     }
 
@@ -468,6 +494,49 @@ class Memory extends AbstractAdapter
         }
     }
 
+    /**
+     * Resolves the roles inherited by every role and which rule grants or
+     * denies each access of every component, including the wildcards, so
+     * that `isAllowed()` does not need to walk the inherited roles
+     *
+     * ```php
+     * $acl->compile();
+     * ```
+     */
+    public function compile() -> void
+    {
+        var roleName, accessName, componentName, parts;
+
+        if empty this->rolesNames {
+            return;
+        }
+
+        for roleName, _ in this->rolesNames {
+            this->getInheritedRoles(roleName);
+
+            for accessName, _ in this->accessList {
+                let parts         = explode("!", accessName, 2),
+                    componentName = parts[0];
+
+                if !isset this->accessKeys[roleName][componentName][parts[1]] {
+                    let this->accessKeys[roleName][componentName][parts[1]] = this->canAccess(
+                        roleName,
+                        componentName,
+                        parts[1]
+                    );
+                }
+
+                if !isset this->accessKeys[roleName][componentName]["*"] {
+                    let this->accessKeys[roleName][componentName]["*"] = this->canAccess(
+                        roleName,
+                        componentName,
+                        "*"
+                    );
+                }
+            }
+        }
+    }
+
     /**
      * Deny access to a role on a component. You can use `*` as wildcard
      *
@@ -530,6 +599,70 @@ class Memory extends AbstractAdapter
         }
      }
 
+    /**
+     * Compiles the list and returns it as an array of scalars, which can be
+     * stored i.e. in APCu or exported to a PHP file and restored with
+     * `import()` instead of building the list on every request. Lists with
+     * functions cannot be exported
+     *
+     * ```php
+     * $acl->compile();
+     *
+     * file_put_contents(
+     *     "acl.php",
+     *     "<?php return " . var_export($acl->export(), true) . ";"
+     * );
+     * ```
+     */
+    public function export() -> array
+    {
+        var component, role;
+        array components, roles;
+
+        if unlikely !empty this->func {
+            throw new Exception(
+                "Access lists with functions cannot be exported"
+            );
+        }
+
+        this->compile();
+
+        let components = [],
+            roles      = [];
+
+        if typeof this->components == "array" {
+            for component in this->components {
+                let components[] = [
+                    component->getName(),
+                    component->getDescription()
+                ];
+            }
+        }
+
+        if typeof this->roles == "array" {
+            for role in this->roles {
+                let roles[] = [
+                    role->getName(),
+                    role->getDescription()
+                ];
+            }
+        }
+
+        return [
+            "access"                   : this->access,
+            "accessKeys"               : this->accessKeys,
+            "accessList"               : this->accessList,
+            "components"               : components,
+            "componentsNames"          : this->componentsNames,
+            "defaultAccess"            : this->defaultAccess,
+            "inheritedRoles"           : this->inheritedRoles,
+            "noArgumentsDefaultAction" : this->noArgumentsDefaultAction,
+            "roleInherits"             : this->roleInherits,
+            "roles"                    : roles,
+            "rolesNames"               : this->rolesNames
+        ];
+    }
+
     /**
      * Returns the default ACL access level for no arguments provided in
      * `isAllowed` action if a `func` (callable) exists for `accessKey`
@@ -555,6 +688,52 @@ class Memory extends AbstractAdapter
         return this->components;
     }
 
+    /**
+     * Restores a list returned by `export()`
+     *
+     * ```php
+     * $acl = new \Phalcon\Acl\Adapter\Memory();
+     *
+     * $acl->import(
+     *     require "acl.php"
+     * );
+     * ```
+     */
+    public function import(array! data) -> void
+    {
+        var component, role;
+        array components, roles;
+
+        if unlikely !isset data["accessKeys"] || !isset data["rolesNames"] {
+            throw new Exception("The data is not an exported access list");
+        }
+
+        let components = [],
+            roles      = [];
+
+        for component in data["components"] {
+            let components[] = new Component(component[0], component[1]);
+        }
+
+        for role in data["roles"] {
+            let roles[] = new Role(role[0], role[1]);
+        }
+
+        let this->access                   = data["access"],
+            this->accessKeys               = data["accessKeys"],
+            this->accessList               = data["accessList"],
+            this->components               = components,
+            this->componentsNames          = data["componentsNames"],
+            this->defaultAccess            = data["defaultAccess"],
+            this->func                     = null,
+            this->funcParameters           = [],
+            this->inheritedRoles           = data["inheritedRoles"],
+            this->noArgumentsDefaultAction = data["noArgumentsDefaultAction"],
+            this->roleInherits             = data["roleInherits"],
+            this->roles                    = roles,
+            this->rolesNames               = data["rolesNames"];
+    }
+
     /**
      * Check whether a role is allowed to access an action from a component
      *
@@ -570,10 +749,9 @@ class Memory extends AbstractAdapter
     {
         var accessKey, accessList, componentObject = null, haveAccess = null,
             eventsManager, funcAccess = null, funcList, numberOfRequiredParameters,
-            reflectionFunction, reflectionParameters, parameterNumber,
-            parameterToCheck, parametersForFunction, reflectionClass,
-            reflectionParameter, rolesNames, roleObject = null,
-            userParametersSizeShouldBe;
+            functionParameters, parameterNumber, parameterToCheck,
+            parametersForFunction, parameterClass, functionParameter,
+            rolesNames, roleObject = null, userParametersSizeShouldBe;
 
         bool hasComponent = false, hasRole = false;
 
@@ -635,7 +813,12 @@ class Memory extends AbstractAdapter
         /**
          * Check if there is a direct combination for role-component-access
          */
-        let accessKey = this->canAccess(roleName, componentName, access);
+        if isset this->accessKeys[roleName][componentName][access] {
+            let accessKey = this->accessKeys[roleName][componentName][access];
+        } else {
+            let accessKey = this->canAccess(roleName, componentName, access),
+                this->accessKeys[roleName][componentName][access] = accessKey;
+        }
 
         if accessKey != false && isset accessList[accessKey] {
             let haveAccess = accessList[accessKey];
@@ -669,9 +852,8 @@ class Memory extends AbstractAdapter
          * If we have funcAccess then do all the checks for it
          */
         if is_callable(funcAccess) {
-            let reflectionFunction   = new ReflectionFunction(funcAccess),
-                reflectionParameters = reflectionFunction->getParameters(),
-                parameterNumber      = count(reflectionParameters);
+            let functionParameters = this->getFuncParameters(accessKey, funcAccess),
+                parameterNumber    = count(functionParameters[1]);
 
             /**
              * No parameters, just return haveAccess and call function without
@@ -682,17 +864,17 @@ class Memory extends AbstractAdapter
             }
 
             let parametersForFunction      = [],
-                numberOfRequiredParameters = reflectionFunction->getNumberOfRequiredParameters(),
+                numberOfRequiredParameters = functionParameters[0],
                 userParametersSizeShouldBe = parameterNumber;
 
-            for reflectionParameter in reflectionParameters {
-                let reflectionClass  = reflectionParameter->getClass(),
-                    parameterToCheck = reflectionParameter->getName();
+            for functionParameter in functionParameters[1] {
+                let parameterToCheck = functionParameter[0],
+                    parameterClass   = functionParameter[1];
 
-                if reflectionClass !== null {
+                if parameterClass !== null {
                     // roleObject is this class
                     if (roleObject !== null &&
-                        reflectionClass->isInstance(roleObject) &&
+                        is_a(roleObject, parameterClass) &&
                         !hasRole
                     ) {
                         let hasRole                 = true,
@@ -704,7 +886,7 @@ class Memory extends AbstractAdapter
 
                     // componentObject is this class
                     if (componentObject !== null &&
-                        reflectionClass->isInstance(componentObject) &&
+                        is_a(componentObject, parameterClass) &&
                         !hasComponent
                     ) {
                         let hasComponent            = true,
@@ -720,7 +902,7 @@ class Memory extends AbstractAdapter
                      */
                     if unlikely (isset(parameters[parameterToCheck]) &&
                         is_object(parameters[parameterToCheck]) &&
-                        !reflectionClass->isInstance(parameters[parameterToCheck])
+                        !is_a(parameters[parameterToCheck], parameterClass)
                     ) {
                         throw new Exception(
                             "Your passed parameter doesn't have the " .
@@ -729,7 +911,7 @@ class Memory extends AbstractAdapter
                             " " . componentName . ". Class passed: " .
                             get_class(parameters[parameterToCheck]) .
                             " , Class in defined function: " .
-                            reflectionClass->getName() . "."
+                            parameterClass . "."
                         );
                     }
                 }
@@ -835,7 +1017,9 @@ class Memory extends AbstractAdapter
             );
         }
 
-        let accessList = this->accessList;
+        let accessList           = this->accessList,
+            this->accessKeys     = [],
+            this->funcParameters = [];
 
         if typeof access == "array" {
             for accessName in access {
@@ -887,8 +1071,7 @@ class Memory extends AbstractAdapter
      */
     private function canAccess(string roleName, string componentName, string access) -> string | bool
     {
-        var accessList, checkRoleToInherit, usedRoleToInherit;
-        array usedRoleToInherits, checkRoleToInherits;
+        var accessList, checkRoleToInherit;
         string accessKey;
 
         let accessList = this->access;
@@ -921,8 +1104,96 @@ class Memory extends AbstractAdapter
         }
 
         /**
-         * Deep check if the role to inherit is valid
+         * Check the inherited roles
          */
+        for checkRoleToInherit in this->getInheritedRoles(roleName) {
+            let accessKey = checkRoleToInherit . "!" . componentName . "!" . access;
+
+            /**
+             * Check if there is a direct combination in one of the
+             * inherited roles
+             */
+            if isset accessList[accessKey] {
+                return accessKey;
+            }
+
+            /**
+             * Check if there is a direct combination for role-*-*
+             */
+            let accessKey = checkRoleToInherit . "!" . componentName . "!*";
+
+            if isset accessList[accessKey] {
+                return accessKey;
+            }
+
+            /**
+             * Check if there is a direct combination for role-*-*
+             */
+            let accessKey = checkRoleToInherit . "!*!*";
+
+            if isset accessList[accessKey] {
+                return accessKey;
+            }
+        }
+
+        return false;
+    }
+
+    /**
+     * Returns the number of required parameters and the name and class of
+     * every parameter of a function, reflecting it only once
+     */
+    private function getFuncParameters(string accessKey, var funcAccess) -> array
+    {
+        var reflectionFunction, reflectionParameter, reflectionClass,
+            parameterClass;
+        array parameters;
+
+        if isset this->funcParameters[accessKey] {
+            return this->funcParameters[accessKey];
+        }
+
+        let reflectionFunction = new ReflectionFunction(funcAccess),
+            parameters         = [];
+
+        for reflectionParameter in reflectionFunction->getParameters() {
+            let reflectionClass = reflectionParameter->getClass(),
+                parameterClass  = null;
+
+            if reflectionClass !== null {
+                let parameterClass = reflectionClass->getName();
+            }
+
+            let parameters[] = [
+                reflectionParameter->getName(),
+                parameterClass
+            ];
+        }
+
+        let parameters = [
+            reflectionFunction->getNumberOfRequiredParameters(),
+            parameters
+        ];
+
+        let this->funcParameters[accessKey] = parameters;
+
+        return parameters;
+    }
+
+    /**
+     * Returns every role inherited by a role, breadth first
+     */
+    private function getInheritedRoles(string roleName) -> array
+    {
+        var checkRoleToInherit, usedRoleToInherit;
+        array checkRoleToInherits, inheritedRoles, usedRoleToInherits;
+
+        if isset this->inheritedRoles[roleName] {
+            return this->inheritedRoles[roleName];
+        }
+
+        let inheritedRoles = [];
+
         if isset this->roleInherits[roleName] {
             let checkRoleToInherits = [];
 
@@ -939,35 +1210,8 @@ class Memory extends AbstractAdapter
                     continue;
                 }
 
-                let usedRoleToInherits[checkRoleToInherit] = true;
-
-                let accessKey = checkRoleToInherit . "!" . componentName . "!" . access;
-
-                /**
-                 * Check if there is a direct combination in one of the
-                 * inherited roles
-                 */
-                if isset accessList[accessKey] {
-                    return accessKey;
-                }
-
-                /**
-                 * Check if there is a direct combination for role-*-*
-                 */
-                let accessKey = checkRoleToInherit . "!" . componentName . "!*";
-
-                if isset accessList[accessKey] {
-                    return accessKey;
-                }
-
-                /**
-                 * Check if there is a direct combination for role-*-*
-                 */
-                let accessKey = checkRoleToInherit . "!*!*";
-
-                if isset accessList[accessKey] {
-                    return accessKey;
-                }
+                let usedRoleToInherits[checkRoleToInherit] = true,
+                    inheritedRoles[]                       = checkRoleToInherit;
 
                 /**
                  * Push inherited roles
@@ -980,6 +1224,8 @@ class Memory extends AbstractAdapter
             }
         }
 
-        return false;
+        let this->inheritedRoles[roleName] = inheritedRoles;
+
+        return inheritedRoles;
     }
 }
@@ -10,11 +10,15 @@
 
 namespace Phalcon\Annotations\Adapter;
 
+use FilesystemIterator;
 use Phalcon\Annotations\Reader;
 use Phalcon\Annotations\Exception;
 use Phalcon\Annotations\Collection;
 use Phalcon\Annotations\Reflection;
 use Phalcon\Annotations\ReaderInterface;
+use RecursiveDirectoryIterator;
+use RecursiveIteratorIterator;
+use Throwable;
 
 /**
  * This is the base class for Phalcon\Annotations adapters
@@ -63,11 +67,13 @@ abstract class AbstractAdapter implements AdapterInterface
             let reader = this->getReader(),
                 parsedAnnotations = reader->parse(realClassName);
 
-            let classAnnotations = new Reflection(parsedAnnotations),
-                this->annotations[realClassName] = classAnnotations;
-                this->{"write"}(realClassName, classAnnotations);
+            let classAnnotations = new Reflection(parsedAnnotations);
+
+            this->{"write"}(realClassName, classAnnotations);
         }
 
+        let this->annotations[realClassName] = classAnnotations;
+
         return classAnnotations;
     }
 
@@ -172,4 +178,132 @@ abstract class AbstractAdapter implements AdapterInterface
     {
         let this->reader = reader;
     }
+
+    /**
+     * Parses and stores the annotations of every class declared in the PHP
+     * files of a directory and its subdirectories, i.e. from a CLI task during
+     * a deploy. The files are not executed: the classes declared in them are
+     * loaded through the autoloader, and the ones it cannot load are skipped.
+     * Stored annotations are always refreshed. Returns the names of the
+     * classes
+     *
+     *```php
+     * $annotations->warmup("app/controllers/");
+     *```
+     */
+    public function warmup(string! directory) -> array
+    {
+        var basePath, className, classAnnotations, e, file, iterator;
+        bool exists;
+        array classNames;
+
+        let basePath = realpath(directory);
+
+        if unlikely basePath === false || !is_dir(basePath) {
+            throw new Exception("Directory " . directory . " does not exist");
+        }
+
+        let iterator = new RecursiveIteratorIterator(
+            new RecursiveDirectoryIterator(
+                basePath,
+                FilesystemIterator::SKIP_DOTS
+            )
+        );
+
+        let classNames = [];
+
+        for file in iterator {
+            if !file->isFile() || file->getExtension() !== "php" {
+                continue;
+            }
+
+            for className in this->getDeclaredClasses(file->getPathname()) {
+                try {
+                    let exists = class_exists(className);
+                } catch Throwable, e {
+                    let exists = false;
+                }
+
+                if !exists {
+                    continue;
+                }
+
+                let classAnnotations = new Reflection(
+                    this->getReader()->parse(className)
+                );
+
+                this->{"write"}(className, classAnnotations);
+
+                let this->annotations[className] = classAnnotations,
+                    classNames[]                 = className;
+            }
+        }
+
+        return classNames;
+    }
+
+    /**
+     * Returns the names of the classes declared in a PHP file, reading its
+     * tokens instead of executing it
+     */
+    private function getDeclaredClasses(string! fileName) -> array
+    {
+        var previous, token;
+        array classNames;
+        int state;
+        string namespaceName;
+
+        let classNames    = [],
+            namespaceName = "",
+            previous      = null,
+            state         = 0;
+
+        /**
+         * The state is 1 while reading a namespace name and 2 when a class
+         * name is expected
+         */
+        for token in token_get_all(file_get_contents(fileName)) {
+            if typeof token == "array" {
+                if token[0] === T_WHITESPACE || token[0] === T_COMMENT || token[0] === T_DOC_COMMENT {
+                    continue;
+                }
+            }
+
+            if state === 1 {
+                if typeof token == "array" {
+                    let namespaceName .= token[1];
+
+                    continue;
+                }
+
+                let state = 0;
+            } elseif state === 2 {
+                if typeof token == "array" && token[0] === T_STRING {
+                    let classNames[] = ltrim(namespaceName . "\\" . token[1], "\\");
+                }
+
+                let state = 0;
+            }
+
+            if typeof token != "array" {
+                let previous = token;
+
+                continue;
+            }
+
+            if token[0] === T_NAMESPACE {
+                let namespaceName = "",
+                    state         = 1;
+            } elseif token[0] === T_CLASS && previous !== T_DOUBLE_COLON && previous !== T_NEW {
+                /**
+                 * Skips Foo::class and anonymous classes
+                 */
+                let state = 2;
+            }
+
+            let previous = token[0];
+        }
+
+        return classNames;
+    }
 }
@@ -12,6 +12,7 @@ namespace Phalcon\Annotations\Adapter;
 
 use Phalcon\Annotations\Reflection;
 use Phalcon\Annotations\Exception;
+use Phalcon\Helper\Fs;
 use RuntimeException;
 
 /**
@@ -51,11 +52,14 @@ class Stream extends AbstractAdapter
     }
 
     /**
-     * Reads parsed annotations from files
+     * Reads parsed annotations from files. The files return arrays, kept in
+     * shared memory by opcache, from which the collections are created when
+     * they are requested. Files which are not PHP, i.e. written in the
+     * previous serialized format, are ignored
      */
     public function read(string key) -> <Reflection> | bool | int
     {
-        var contents, version;
+        var contents;
         string path;
 
         /**
@@ -67,42 +71,19 @@ class Stream extends AbstractAdapter
             return false;
         }
 
-        let contents = file_get_contents(path);
-
-        if unlikely empty contents {
+        if unlikely file_get_contents(path, false, null, 0, 5) !== "<?php" {
             return false;
         }
 
-        globals_set("warning.enable", false);
-
-        let version = phpversion();
-        if version_compare(version, "8.0", ">=") {
-            set_error_handler(
-                function (number, message, file, line) {
-                    globals_set("warning.enable", true);
-                },
-                E_WARNING
-            );
-        } else {
-            set_error_handler(
-                function (number, message, file, line, context) {
-                    globals_set("warning.enable", true);
-                },
-                E_WARNING
-            );
-        }
+        let contents = require path;
 
-        let contents = unserialize(contents);
-
-        restore_error_handler();
-
-        if unlikely globals_get("warning.enable") {
+        if unlikely typeof contents != "array" {
             throw new RuntimeException(
                 "Cannot read annotation data"
             );
         }
 
-        return contents;
+        return new Reflection(contents);
     }
 
     /**
@@ -117,10 +98,14 @@ class Stream extends AbstractAdapter
          * Paths must be normalized before be used as keys
          */
         let path = this->annotationsDir . prepare_virtual_path(key, "_") . ".php",
-            code = serialize(data);
+            code = "<?php return " . var_export(data->getReflectionData(), true) . "; ";
 
-        if unlikely file_put_contents(path, code) === false {
-              throw new Exception("Annotations directory cannot be written");
+        /**
+         * The file is renamed once written, so that a concurrent request never
+         * includes a partially written file
+         */
+        if unlikely !Fs::write(path, code) {
+            throw new Exception("Annotations directory cannot be written");
         }
     }
 }
@@ -17,6 +17,7 @@ use Phalcon\Assets\Inline\Css as InlineCss;
 use Phalcon\Assets\Inline\Js as InlineJs;
 use Phalcon\Di\DiInterface;
 use Phalcon\Di\AbstractInjectionAware;
+use Phalcon\Helper\Fs;
 
 /**
  * Phalcon\Assets\Manager
@@ -42,6 +43,13 @@ class Manager extends AbstractInjectionAware
      */
     protected implicitOutput = true;
 
+    /**
+     * Built bundles, loaded from the "manifest" option
+     *
+     * @var array|null
+     */
+    protected manifest = null;
+
     /**
      * Phalcon\Assets\Manager constructor
      */
@@ -208,6 +216,159 @@ class Manager extends AbstractInjectionAware
         return this;
     }
 
+    /**
+     * Builds the joined and filtered content of a collection into a
+     * fingerprinted bundle (e.g. "app.3f9a1c0b.js") with a precompressed
+     * ".gz" sibling, and records it by target URI and type in the manifest
+     * set with the "manifest" option. The filtered content of each source
+     * is kept by its hash, so only changed sources are filtered again. Once
+     * built, output() uses the manifest and does not read the sources
+     * anymore.
+     *
+     *```php
+     * $assets = new Manager(
+     *     [
+     *         "manifest"       => "/app/var/assets/manifest.php",
+     *         "targetBasePath" => "/app/public/",
+     *     ]
+     * );
+     *
+     * $assets
+     *     ->collection("app")
+     *     ->setTargetPath("js/app.js")
+     *     ->setTargetUri("js/app.js")
+     *     ->addJs("js/jquery.js")
+     *     ->join(true)
+     *     ->addFilter(new Jsmin());
+     *
+     * $assets->build($assets->get("app"), "js"); // "js/app.3f9a1c0b.js"
+     *```
+     */
+    public function build(<Collection> collection, string! type) -> string
+    {
+        var asset, bundlePath, bundleUri, cacheDirectory, cacheFile, content,
+            filter, filters, hash, manifest, manifestPath, options,
+            sourceBasePath = "", sources, targetBasePath = "", targetPath,
+            targetUri;
+        string filterKey, joined;
+
+        let options = this->options;
+
+        if unlikely !fetch manifestPath, options["manifest"] {
+            throw new Exception(
+                "The 'manifest' option is required to build a collection"
+            );
+        }
+
+        fetch sourceBasePath, options["sourceBasePath"];
+        fetch targetBasePath, options["targetBasePath"];
+
+        let targetPath = targetBasePath . collection->getTargetPath(),
+            targetUri  = collection->getTargetUri();
+
+        if unlikely !collection->getTargetPath() || is_dir(targetPath) {
+            throw new Exception(
+                "Path '" . targetPath . "' is not a valid target path"
+            );
+        }
+
+        if unlikely !targetUri {
+            throw new Exception(
+                "The collection must have a target URI to be built"
+            );
+        }
+
+        let filters        = collection->getFilters(),
+            cacheDirectory = dirname(manifestPath) . DIRECTORY_SEPARATOR . "cache",
+            filterKey      = "";
+
+        for filter in filters {
+            if unlikely typeof filter != "object" {
+                throw new Exception("Filter is invalid");
+            }
+
+            let filterKey .= get_class(filter) . ",";
+        }
+
+        /**
+         * The directory may have been created by a concurrent build
+         */
+        if !is_dir(cacheDirectory) && !mkdir(cacheDirectory, 0777, true) && !is_dir(cacheDirectory) {
+            throw new Exception(
+                "Directory '" . cacheDirectory . "' cannot be created"
+            );
+        }
+
+        let joined  = "",
+            sources = [];
+
+        for asset in this->collectionAssetsByType(collection->getAssets(), type) {
+            let content = asset->getContent(sourceBasePath . collection->getSourcePath()),
+                hash    = sha1(filterKey . content);
+
+            if asset->getFilter() && count(filters) {
+                /**
+                 * Sources that did not change are not filtered again
+                 */
+                let cacheFile = cacheDirectory . DIRECTORY_SEPARATOR . hash . "." . type;
+
+                if file_exists(cacheFile) {
+                    let content = file_get_contents(cacheFile);
+                } else {
+                    for filter in filters {
+                        let content = filter->filter(content);
+                    }
+
+                    this->writeFile(cacheFile, content);
+                }
+
+                if type != "css" {
+                    let content .= ";";
+                }
+            }
+
+            let joined                   .= content,
+                sources[asset->getPath()] = hash;
+        }
+
+        let hash       = substr(sha1(joined), 0, 8),
+            bundlePath = this->getFingerprintedPath(targetPath, hash),
+            bundleUri  = this->getFingerprintedPath(targetUri, hash);
+
+        if !file_exists(bundlePath) {
+            this->writeFile(bundlePath, joined);
+
+            if function_exists("gzencode") {
+                this->writeFile(bundlePath . ".gz", gzencode(joined, 9));
+            }
+        }
+
+        /**
+         * Read the manifest again, it could have been changed by another
+         * build
+         */
+        let this->manifest = null,
+            manifest       = this->getManifest();
+
+        let manifest[targetUri][type] = [
+            "uri"     : bundleUri,
+            "sources" : sources
+        ];
+
+        this->writeFile(
+            manifestPath,
+            "<?php return " . var_export(manifest, true) . ";"
+        );
+
+        if function_exists("opcache_invalidate") {
+            opcache_invalidate(manifestPath, true);
+        }
+
+        let this->manifest = manifest;
+
+        return bundleUri;
+    }
+
     /**
      * Creates/Returns a collection of assets
      */
@@ -337,7 +498,7 @@ class Manager extends AbstractInjectionAware
         var asset, assets, attributes, autoVersion, collectionSourcePath,
             collectionTargetPath, completeSourcePath, completeTargetPath,
             content, filter, filters, filteredContent, filteredJoinedContent,
-            filterNeeded, html, join, local, modificationTime, mustFilter,
+            filterNeeded, html, join, local, manifest, modificationTime, mustFilter,
             options, parameters, path, prefixedPath, sourceBasePath = null,
             sourcePath,  targetBasePath = null, targetPath, targetUri, typeCss,
             useImplicitOutput, version;
@@ -345,6 +506,37 @@ class Manager extends AbstractInjectionAware
         let useImplicitOutput = this->implicitOutput,
             output            = "";
 
+        /**
+         * Built bundles are resolved from the manifest, without reading or
+         * filtering the sources
+         */
+        if collection->getJoin() && count(collection->getFilters()) {
+            let manifest = this->getManifest();
+
+            if fetch path, manifest[collection->getTargetUri()][type]["uri"] {
+                let prefixedPath = this->getPrefixedPath(collection, path),
+                    attributes   = collection->getAttributes();
+
+                if typeof attributes == "array" {
+                    let attributes[0] = prefixedPath,
+                        parameters    = [attributes];
+                } else {
+                    let parameters = [prefixedPath];
+                }
+
+                let parameters[] = collection->getTargetLocal(),
+                    html         = call_user_func_array(callback, parameters);
+
+                if useImplicitOutput == true {
+                    echo html;
+
+                    return output;
+                }
+
+                return html;
+            }
+        }
+
         /**
          * Get the assets as an array
          */
@@ -925,7 +1117,8 @@ class Manager extends AbstractInjectionAware
      */
     public function setOptions(array! options) -> <Manager>
     {
-        let this->options = options;
+        let this->options  = options,
+            this->manifest = null;
 
         return this;
     }
@@ -940,6 +1133,50 @@ class Manager extends AbstractInjectionAware
         return this;
     }
 
+    /**
+     * Adds the hash before the extension of a path
+     */
+    private function getFingerprintedPath(string! path, string! hash) -> string
+    {
+        var extension;
+
+        let extension = pathinfo(path, PATHINFO_EXTENSION);
+
+        if !extension {
+            return path . "." . hash;
+        }
+
+        return substr(path, 0, -(strlen(extension) + 1)) . "." . hash . "." . extension;
+    }
+
+    /**
+     * Returns the built bundles, read once from the "manifest" option
+     */
+    private function getManifest() -> array
+    {
+        var manifest, path;
+
+        if this->manifest !== null {
+            return this->manifest;
+        }
+
+        let manifest = [];
+
+        if fetch path, this->options["manifest"] {
+            if file_exists(path) {
+                let manifest = require path;
+
+                if typeof manifest != "array" {
+                    let manifest = [];
+                }
+            }
+        }
+
+        let this->manifest = manifest;
+
+        return manifest;
+    }
+
     /**
      * Returns the prefixed path
      */
@@ -955,4 +1192,17 @@ class Manager extends AbstractInjectionAware
 
         return prefix . path;
     }
+
+    /**
+     * Writes a file through Fs::write(), so that it is never read partially
+     * written
+     */
+    private function writeFile(string! path, string! contents) -> void
+    {
+        if unlikely !Fs::write(path, contents) {
+            throw new Exception(
+                "File '" . path . "' cannot be written"
+            );
+        }
+    }
 }
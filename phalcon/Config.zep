@@ -13,6 +13,8 @@ namespace Phalcon;
 use Phalcon\Collection;
 use Phalcon\Config\ConfigInterface;
 use Phalcon\Config\Exception;
+use Phalcon\Config\Frozen;
+use Phalcon\Helper\Fs;
 
 /**
  * `Phalcon\Config` is designed to simplify the access to, and the use of,
@@ -48,6 +50,40 @@ class Config extends Collection implements ConfigInterface
      */
     protected pathDelimiter = null;
 
+    /**
+     * Writes the resolved configuration and its flattened path index to a
+     * PHP file, so that `Phalcon\Config\Adapter\Compiled` can load it from
+     * opcache, and returns the read only configuration
+     *
+     *```php
+     * $config = new \Phalcon\Config\Adapter\Yaml("config/config.yml");
+     *
+     * $frozen = $config->compile("cache/config.php");
+     *
+     * // Later requests
+     * $config = new \Phalcon\Config\Adapter\Compiled("cache/config.php");
+     *```
+     */
+    public function compile(string! filePath) -> <Frozen>
+    {
+        var frozen;
+        array compiled;
+
+        let frozen   = new Frozen(this->toArray()),
+            compiled = [
+                "data"  : frozen->toArray(),
+                "paths" : frozen->getPaths()
+            ];
+
+        if unlikely !Fs::write(filePath, "<?php return " . var_export(compiled, true) . ";") {
+            throw new Exception(
+                "File '" . filePath . "' cannot be written"
+            );
+        }
+
+        return frozen;
+    }
+
     /**
      * Gets the default path delimiter
      *
@@ -118,7 +154,7 @@ class Config extends Collection implements ConfigInterface
             let delimiter = this->getPathDelimiter();
         }
 
-        let config = clone this,
+        let config = this,
             keys   = explode(delimiter, path);
 
         while (!empty(keys)) {
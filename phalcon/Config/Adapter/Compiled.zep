@@ -0,0 +1,68 @@
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+namespace Phalcon\Config\Adapter;
+
+use Phalcon\Config\Exception;
+use Phalcon\Config\Frozen;
+
+/**
+ * Reads a file written by `Phalcon\Config::compile()` into a read only
+ * configuration. The file is a plain PHP array, so opcache serves both the
+ * data and its path index from shared memory without parsing or merging the
+ * original sources.
+ *
+ *```php
+ * use Phalcon\Config\Adapter\Compiled;
+ * use Phalcon\Config\Adapter\Grouped;
+ *
+ * $compiledPath = "cache/config.php";
+ *
+ * if (file_exists($compiledPath)) {
+ *     $config = new Compiled($compiledPath);
+ * } else {
+ *     $grouped = new Grouped(
+ *         [
+ *             "config/app.yml",
+ *             "config/database.ini",
+ *         ]
+ *     );
+ *
+ *     $config = $grouped->compile($compiledPath);
+ * }
+ *
+ * echo $config->path("database.host");
+ *```
+ */
+class Compiled extends Frozen
+{
+    /**
+     * Phalcon\Config\Adapter\Compiled constructor
+     */
+    public function __construct(string! filePath)
+    {
+        var compiled, data, paths;
+
+        let compiled = require filePath;
+
+        if unlikely typeof compiled !== "array" ||
+            !isset compiled["data"] ||
+            !isset compiled["paths"] {
+            throw new Exception(
+                "The file '" . filePath . "' is not a compiled configuration"
+            );
+        }
+
+        let data  = compiled["data"],
+            paths = compiled["paths"];
+
+        parent::__construct(data, paths);
+    }
+}
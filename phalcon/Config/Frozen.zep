@@ -0,0 +1,284 @@
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+namespace Phalcon\Config;
+
+use ArrayIterator;
+use Phalcon\Config;
+use Traversable;
+
+/**
+ * Phalcon\Config\Frozen is a read only configuration. Nested arrays are kept
+ * as plain arrays and the dotted path of every value is resolved through a
+ * flat index, so `path()` is a single lookup. Nested `Frozen` objects are only
+ * created when a node is requested and are reused afterwards.
+ *
+ *```php
+ * use Phalcon\Config\Frozen;
+ *
+ * $config = new Frozen(
+ *     [
+ *         "database" => [
+ *             "host" => "localhost",
+ *         ],
+ *     ]
+ * );
+ *
+ * echo $config->path("database.host");
+ * echo $config->database->host;
+ *```
+ */
+class Frozen extends Config
+{
+    /**
+     * @var array
+     */
+    protected nodes = [];
+
+    /**
+     * Values by dotted path, intermediate paths hold an empty array. Built on
+     * first use when not passed to the constructor
+     *
+     * @var array|null
+     */
+    protected paths = null;
+
+    /**
+     * Phalcon\Config\Frozen constructor
+     *
+     * The paths index is built from the data when it is first used, if it is
+     * not passed
+     */
+    public function __construct(array data = [], array paths = [])
+    {
+        var key;
+
+        let this->data      = data,
+            this->lowerKeys = [];
+
+        for key, _ in data {
+            let key = (string) key,
+                this->lowerKeys[key->lower()] = key;
+        }
+
+        if !empty paths {
+            let this->paths = paths;
+        }
+    }
+
+    /**
+     * Clearing a frozen configuration is not allowed
+     */
+    public function clear() -> void
+    {
+        throw new Exception("The configuration is read only");
+    }
+
+    /**
+     * Get the element from the configuration
+     */
+    public function get(
+        string element,
+        var defaultValue = null,
+        string! cast = null
+    ) -> var {
+        var key, value;
+
+        let element = element->lower();
+
+        if unlikely !fetch key, this->lowerKeys[element] {
+            return defaultValue;
+        }
+
+        let value = this->data[key];
+
+        if typeof value === "array" {
+            return this->getNode(element, value);
+        }
+
+        if unlikely cast {
+            settype(value, cast);
+        }
+
+        return value;
+    }
+
+    /**
+     * Returns the iterator of the class
+     */
+    public function getIterator() -> <Traversable>
+    {
+        var key, value;
+        array data;
+
+        let data = [];
+
+        for key, value in this->data {
+            if typeof value === "array" {
+                let value = this->getNode(strtolower(key), value);
+            }
+
+            let data[key] = value;
+        }
+
+        return new ArrayIterator(data);
+    }
+
+    /**
+     * Returns the flattened path index
+     */
+    public function getPaths() -> array
+    {
+        if this->paths === null {
+            let this->paths = this->flatten([], this->data, "");
+        }
+
+        return this->paths;
+    }
+
+    /**
+     * Returns a value from the configuration using a dot separated path.
+     *
+     *```php
+     * echo $config->path("database.replicas.0.host", "default");
+     *```
+     */
+    public function path(string path, defaultValue = null, var delimiter = null) -> var | null
+    {
+        var value;
+
+        if likely empty(delimiter) {
+            let delimiter = this->getPathDelimiter();
+        }
+
+        if unlikely delimiter !== self::DEFAULT_PATH_DELIMITER {
+            let path = str_replace(delimiter, self::DEFAULT_PATH_DELIMITER, path);
+        }
+
+        let path = path->lower();
+
+        if unlikely this->paths === null {
+            let this->paths = this->flatten([], this->data, "");
+        }
+
+        if !fetch value, this->paths[path] {
+            return defaultValue;
+        }
+
+        /**
+         * Intermediate paths are resolved from the data
+         */
+        if typeof value === "array" {
+            return this->getPathNode(path, defaultValue);
+        }
+
+        return value;
+    }
+
+    /**
+     * Removing elements from a frozen configuration is not allowed
+     */
+    public function remove(string element) -> void
+    {
+        throw new Exception("The configuration is read only");
+    }
+
+    /**
+     * Returns the configuration as an array
+     */
+    public function toArray() -> array
+    {
+        return this->data;
+    }
+
+    /**
+     * Adds every key of the data to the paths index, prefixed with the path of
+     * its parents. Only the values are stored, nested arrays are marked with an
+     * empty array
+     */
+    protected function flatten(array paths, array data, string prefix) -> array
+    {
+        var key, value;
+        string path;
+
+        for key, value in data {
+            let path = prefix . strtolower(key);
+
+            if typeof value !== "array" {
+                let paths[path] = value;
+
+                continue;
+            }
+
+            let paths[path] = [],
+                paths       = this->flatten(
+                    paths,
+                    value,
+                    path . self::DEFAULT_PATH_DELIMITER
+                );
+        }
+
+        return paths;
+    }
+
+    /**
+     * Returns the frozen configuration of a nested array, creating it once
+     */
+    protected function getNode(string path, array value) -> <Frozen>
+    {
+        var node;
+
+        if !fetch node, this->nodes[path] {
+            let node              = new Frozen(value),
+                this->nodes[path] = node;
+        }
+
+        return node;
+    }
+
+    /**
+     * Returns the frozen configuration of an intermediate path, walking the
+     * nodes of the data once
+     */
+    protected function getPathNode(string path, var defaultValue) -> var
+    {
+        var key, node;
+
+        if fetch node, this->nodes[path] {
+            return node;
+        }
+
+        let node = this;
+
+        for key in explode(self::DEFAULT_PATH_DELIMITER, path) {
+            if unlikely !(node instanceof Frozen) {
+                return defaultValue;
+            }
+
+            let node = node->get(key);
+        }
+
+        if unlikely !(node instanceof Frozen) {
+            return defaultValue;
+        }
+
+        let this->nodes[path] = node;
+
+        return node;
+    }
+
+    /**
+     * Setting elements in a frozen configuration is not allowed
+     */
+    protected function setData(var element, var value) -> void
+    {
+        throw new Exception("The configuration is read only");
+    }
+}
@@ -17,6 +17,8 @@ namespace Phalcon\DataMapper\Pdo;
 
 use Phalcon\DataMapper\Pdo\Connection\ConnectionInterface;
 use Phalcon\DataMapper\Pdo\Exception\ConnectionNotFound;
+use Phalcon\Db\ReplicaStrategy;
+use Throwable;
 
 /**
  * Manages Connection instances for default, read, and write connections.
@@ -41,6 +43,13 @@ class ConnectionLocator implements ConnectionLocatorInterface
      */
     protected read = [];
 
+    /**
+     * The strategy picking the read connections, if any
+     *
+     * @var ReplicaStrategy|null
+     */
+    protected strategy = null;
+
     /**
      * A registry of Connection "write" factories/instances.
      *
@@ -55,6 +64,13 @@ class ConnectionLocator implements ConnectionLocatorInterface
      */
     private instances = [];
 
+    /**
+     * The last write connection returned
+     *
+     * @var ConnectionInterface|null
+     */
+    private lastWrite = null;
+
     /**
      * Constructor.
      *
@@ -95,6 +111,11 @@ class ConnectionLocator implements ConnectionLocatorInterface
      * random connection; if no read connections are present, returns the
      * default connection.
      *
+     * With a replica strategy, a connection is picked by weight among the
+     * connections not marked down, and connected; one failing to connect is
+     * marked down and another one is picked. When none is left, or when a
+     * sticky strategy recorded a write, the write connection is returned.
+     *
      * @param string $name
      *
      * @return ConnectionInterface
@@ -102,9 +123,23 @@ class ConnectionLocator implements ConnectionLocatorInterface
      */
     public function getRead(string name = "") -> <ConnectionInterface>
     {
+        if "" === name && this->strategy !== null && !empty this->read {
+            return this->getReplica();
+        }
+
         return this->getConnection("read", name);
     }
 
+    /**
+     * Returns the replica strategy, if any
+     *
+     * @return ReplicaStrategy|null
+     */
+    public function getStrategy() -> <ReplicaStrategy> | null
+    {
+        return this->strategy;
+    }
+
     /**
      * Returns a write connection by name; if no name is given, picks a
      * random connection; if no write connections are present, returns the
@@ -117,7 +152,17 @@ class ConnectionLocator implements ConnectionLocatorInterface
      */
     public function getWrite(string name = "") -> <ConnectionInterface>
     {
-        return this->getConnection("write", name);
+        var connection;
+
+        let connection = this->getConnection("write", name);
+
+        if this->strategy !== null {
+            this->strategy->recordWrite();
+
+            let this->lastWrite = connection;
+        }
+
+        return connection;
     }
 
     /**
@@ -151,6 +196,20 @@ class ConnectionLocator implements ConnectionLocatorInterface
         return this;
     }
 
+    /**
+     * Sets the strategy picking the read connections
+     *
+     * @param ReplicaStrategy $strategy
+     *
+     * @return ConnectionLocatorInterface
+     */
+    public function setStrategy(<ReplicaStrategy> strategy) -> <ConnectionLocatorInterface>
+    {
+        let this->strategy = strategy;
+
+        return this;
+    }
+
     /**
      * Sets a write connection factory by name.
      *
@@ -224,4 +283,58 @@ class ConnectionLocator implements ConnectionLocatorInterface
 
         return instances[instanceName];
     }
+
+    /**
+     * Returns a read connection picked by the replica strategy
+     *
+     * @return ConnectionInterface
+     */
+    protected function getReplica() -> <ConnectionInterface>
+    {
+        var connection, instanceName, name, names, strategy;
+
+        let strategy = <ReplicaStrategy> this->strategy;
+
+        if strategy->shouldUseMaster() {
+            if this->lastWrite !== null {
+                return this->lastWrite;
+            }
+
+            return this->getConnection("write");
+        }
+
+        let names = array_keys(this->read);
+
+        loop {
+            let name = strategy->select(names);
+
+            if name === null {
+                return this->getConnection("write");
+            }
+
+            let instanceName = "read-" . name;
+
+            if fetch connection, this->instances[instanceName] {
+                return connection;
+            }
+
+            try {
+                let connection = call_user_func(this->read[name]);
+
+                connection->connect();
+            } catch Throwable {
+                strategy->markDown(name);
+
+                let names = array_diff(names, [name]);
+
+                continue;
+            }
+
+            strategy->markUp(name);
+
+            let this->instances[instanceName] = connection;
+
+            return connection;
+        }
+    }
 }
@@ -906,6 +906,35 @@ abstract class AbstractAdapter implements AdapterInterface, EventsAwareInterface
         return this->insert(table, values, fields, dataTypes);
     }
 
+    /**
+     * Inserts many rows into a table with multi-row INSERT statements. The
+     * rows are split in as many statements as needed to stay below the number
+     * of placeholders the database system accepts; wrap the call in a
+     * transaction to make it atomic
+     *
+     * ```php
+     * // Inserting two robots
+     * $success = $connection->insertMultiple(
+     *     "robots",
+     *     [
+     *         ["Astro Boy", 1952],
+     *         ["Bender", 2999],
+     *     ],
+     *     [
+     *         "name",
+     *         "year",
+     *     ]
+     * );
+     *
+     * // Next SQL sentence is sent to the database system
+     * INSERT INTO `robots` (`name`, `year`) VALUES ("Astro boy", 1952), ("Bender", 2999);
+     * ```
+     */
+    public function insertMultiple(string table, array! rows, array! fields, var dataTypes = null) -> bool
+    {
+        return this->executeMultiple(table, rows, fields, dataTypes, false);
+    }
+
     /**
      * Returns if nested transactions should use savepoints
      */
@@ -1316,6 +1345,41 @@ abstract class AbstractAdapter implements AdapterInterface, EventsAwareInterface
         return this->update(table, fields, values, whereCondition, dataTypes);
     }
 
+    /**
+     * Inserts many rows into a table with multi-row statements, updating the
+     * rows that conflict with the given unique columns instead. All the fields
+     * except the conflicting ones are updated unless updateFields is passed
+     *
+     * ```php
+     * $success = $connection->upsertMultiple(
+     *     "robots",
+     *     [
+     *         [1, "Astro Boy"],
+     *         [2, "Bender"],
+     *     ],
+     *     [
+     *         "id",
+     *         "name",
+     *     ],
+     *     [
+     *         "id",
+     *     ]
+     * );
+     * ```
+     */
+    public function upsertMultiple(string table, array! rows, array! fields, array! conflictFields, var updateFields = null, var dataTypes = null) -> bool
+    {
+        return this->executeMultiple(
+            table,
+            rows,
+            fields,
+            dataTypes,
+            true,
+            conflictFields,
+            updateFields
+        );
+    }
+
     /**
      * Check whether the database system requires an explicit value for identity
      * columns
@@ -1348,4 +1412,125 @@ abstract class AbstractAdapter implements AdapterInterface, EventsAwareInterface
     {
         return this->fetchOne(this->dialect->viewExists(viewName, schemaName), Enum::FETCH_NUM)[0] > 0;
     }
+
+    /**
+     * Executes multi-row INSERT statements, split by the number of
+     * placeholders the dialect accepts
+     */
+    protected function executeMultiple(string table, array! rows, array! fields, var dataTypes, bool upsert, array conflictFields = [], var updateFields = null) -> bool
+    {
+        var batch, bindDataTypes, bindType, bindValues, parts, placeholders,
+            position, row, rowPlaceholders, schemaName, sqlStatement,
+            tableName, value;
+        int batchSize, numberFields;
+        bool success;
+
+        if unlikely !count(rows) {
+            throw new Exception(
+                "Unable to insert into " . table . " without data"
+            );
+        }
+
+        let numberFields = count(fields);
+
+        if unlikely !numberFields {
+            throw new Exception(
+                "Unable to insert multiple rows into " . table . " without fields"
+            );
+        }
+
+        if strpos(table, ".") > 0 {
+            let parts      = explode(".", table),
+                schemaName = parts[0],
+                tableName  = parts[1];
+        } else {
+            let schemaName = null,
+                tableName  = table;
+        }
+
+        let batchSize = (int) (this->dialect->getMaxPlaceholders() / numberFields);
+
+        if batchSize < 1 {
+            let batchSize = 1;
+        }
+
+        for batch in array_chunk(rows, batchSize) {
+            let placeholders  = [],
+                bindValues    = [],
+                bindDataTypes = [];
+
+            for row in batch {
+                if unlikely typeof row != "array" || count(row) != numberFields {
+                    throw new Exception(
+                        "Every row must have a value for each field"
+                    );
+                }
+
+                let rowPlaceholders = [];
+
+                /**
+                 * Objects are casted using __toString, null values are
+                 * converted to string "null", everything else is passed as "?"
+                 */
+                for position, value in array_values(row) {
+                    if typeof value == "object" && value instanceof RawValue {
+                        let rowPlaceholders[] = (string) value;
+                    } else {
+                        if typeof value == "object" {
+                            let value = (string) value;
+                        }
+
+                        if value === null {
+                            let rowPlaceholders[] = "null";
+                        } else {
+                            let rowPlaceholders[] = "?",
+                                bindValues[]      = value;
+
+                            if typeof dataTypes == "array" {
+                                if unlikely !fetch bindType, dataTypes[position] {
+                                    throw new Exception(
+                                        "Incomplete number of bind types"
+                                    );
+                                }
+
+                                let bindDataTypes[] = bindType;
+                            }
+                        }
+                    }
+                }
+
+                let placeholders[] = rowPlaceholders;
+            }
+
+            if upsert {
+                let sqlStatement = this->dialect->upsertMultiple(
+                    tableName,
+                    fields,
+                    placeholders,
+                    conflictFields,
+                    updateFields,
+                    schemaName
+                );
+            } else {
+                let sqlStatement = this->dialect->insertMultiple(
+                    tableName,
+                    fields,
+                    placeholders,
+                    schemaName
+                );
+            }
+
+            if !count(bindDataTypes) {
+                let success = this->{"execute"}(sqlStatement, bindValues);
+            } else {
+                let success = this->{"execute"}(sqlStatement, bindValues, bindDataTypes);
+            }
+
+            if !success {
+                return false;
+            }
+        }
+
+        return true;
+    }
 }
@@ -51,6 +51,38 @@ abstract class AbstractPdo extends AbstractAdapter
      */
     protected pdo;
 
+    /**
+     * Prepared statements by SQL text, the least recently used first. Every
+     * entry holds the statement and a weak reference to the last result
+     * created with it
+     *
+     * @var array
+     */
+    protected statementCache = [];
+
+    /**
+     * Maximum number of prepared statements cached, 0 disables the cache
+     *
+     * @var int
+     */
+    protected statementCacheSize = 0;
+
+    /**
+     * @var array
+     */
+    protected statementCacheStats = [
+        "hits"      : 0,
+        "misses"    : 0,
+        "evictions" : 0
+    ];
+
+    /**
+     * Whether the last statement reused a cached prepared statement
+     *
+     * @var bool
+     */
+    protected statementCached = false;
+
     /**
      * Constructor for Phalcon\Db\Adapter\Pdo
      *
@@ -63,11 +95,18 @@ abstract class AbstractPdo extends AbstractAdapter
      *     'dialectClass' => null,
      *     'options' => [],
      *     'dsn' => null,
-     *     'charset' => 'utf8mb4'
+     *     'charset' => 'utf8mb4',
+     *     'statementCacheSize' => 0
      * ]
      */
     public function __construct(array! descriptor)
     {
+        var statementCacheSize;
+
+        if fetch statementCacheSize, descriptor["statementCacheSize"] {
+            let this->statementCacheSize = (int) statementCacheSize;
+        }
+
         this->connect(descriptor);
 
         parent::__construct(descriptor);
@@ -219,7 +258,8 @@ abstract class AbstractPdo extends AbstractAdapter
      */
     public function close() -> bool
     {
-        let this->pdo = null;
+        let this->pdo            = null,
+            this->statementCache = [];
 
         return true;
     }
@@ -272,6 +312,11 @@ abstract class AbstractPdo extends AbstractAdapter
             unset descriptor["dialectClass"];
         }
 
+        // Same for the size of the statement cache
+        if isset descriptor["statementCacheSize"] {
+            unset descriptor["statementCacheSize"];
+        }
+
         /**
          * Check if the developer has defined custom options or create one from
          * scratch
@@ -316,6 +361,9 @@ abstract class AbstractPdo extends AbstractAdapter
         // Create the dsn attributes string.
         let dsnAttributes = join(";", dsnParts);
 
+        // Statements prepared with a previous connection can not be reused
+        let this->statementCache = [];
+
         // Create the connection using PDO
         let this->pdo = new \PDO(
             this->type . ":" . dsnAttributes,
@@ -442,7 +490,7 @@ abstract class AbstractPdo extends AbstractAdapter
         let pdo = <\PDO> this->pdo;
 
         if !empty bindParams {
-            let statement = pdo->prepare(sqlStatement);
+            let statement = this->getCachedStatement(sqlStatement);
 
             if typeof statement == "object" {
                 let newStatement = this->executePrepared(
@@ -454,7 +502,8 @@ abstract class AbstractPdo extends AbstractAdapter
                 let affectedRows = newStatement->rowCount();
             }
         } else {
-            let affectedRows = pdo->exec(sqlStatement);
+            let this->statementCached = false,
+                affectedRows          = pdo->exec(sqlStatement);
         }
 
         /**
@@ -603,6 +652,36 @@ abstract class AbstractPdo extends AbstractAdapter
         return this->pdo;
     }
 
+    /**
+     * Returns the statistics of the prepared statement cache
+     *
+     *```php
+     * $connection = new Mysql(
+     *     [
+     *         "host"               => "localhost",
+     *         "username"           => "sigma",
+     *         "password"           => "secret",
+     *         "dbname"             => "blog",
+     *         "statementCacheSize" => 128,
+     *     ]
+     * );
+     *
+     * print_r(
+     *     $connection->getStatementCacheStats()
+     * );
+     *```
+     */
+    public function getStatementCacheStats() -> array
+    {
+        return array_merge(
+            this->statementCacheStats,
+            [
+                "size"     : count(this->statementCache),
+                "capacity" : this->statementCacheSize
+            ]
+        );
+    }
+
     /**
      * Returns the current transaction nesting level
      */
@@ -611,6 +690,15 @@ abstract class AbstractPdo extends AbstractAdapter
         return this->transactionLevel;
     }
 
+    /**
+     * Returns whether the last statement executed reused a cached prepared
+     * statement
+     */
+    public function isStatementCached() -> bool
+    {
+        return this->statementCached;
+    }
+
     /**
      * Checks whether the connection is under a transaction
      *
@@ -718,59 +806,28 @@ abstract class AbstractPdo extends AbstractAdapter
      */
     public function query(string! sqlStatement, array! bindParams = [], array! bindTypes = []) -> <ResultInterface> | bool
     {
-        var eventsManager, pdo, statement, params, types;
-
-        let eventsManager = <ManagerInterface> this->eventsManager;
-
-        /**
-         * Execute the beforeQuery event if an EventsManager is available
-         */
-        if typeof eventsManager == "object" {
-            let this->sqlStatement = sqlStatement,
-                this->sqlVariables = bindParams,
-                this->sqlBindTypes = bindTypes;
-
-            if eventsManager->fire("db:beforeQuery", this) === false {
-                return false;
-            }
-        }
-
-        let pdo = <\PDO> this->pdo;
-        if !empty bindParams {
-            let params = bindParams;
-            let types = bindTypes;
-        } else {
-            let params = [];
-            let types = [];
-        }
-
-        let statement = pdo->prepare(sqlStatement);
-        if unlikely typeof statement != "object" {
-            throw new Exception("Cannot prepare statement");
-        }
-
-        this->prepareRealSql(sqlStatement, bindParams);
-
-        let statement = this->executePrepared(statement, params, types);
-
-        /**
-         * Execute the afterQuery event if an EventsManager is available
-         */
-        if typeof statement == "object" {
-            if typeof eventsManager == "object" {
-                eventsManager->fire("db:afterQuery", this);
-            }
-
-            return new ResultPdo(
-                this,
-                statement,
-                sqlStatement,
-                bindParams,
-                bindTypes
-            );
-        }
+        return this->queryStatement(sqlStatement, bindParams, bindTypes, false);
+    }
 
-        return statement;
+    /**
+     * Sends a SQL statement returning rows, reading them from an unbuffered
+     * cursor instead of loading the whole result in memory. The result can
+     * only be traversed forward once, and some database systems do not
+     * accept other statements in the connection until all its rows are read
+     *
+     *```php
+     * $result = $connection->queryUnbuffered(
+     *     "SELECT * FROM robots"
+     * );
+     *
+     * while ($robot = $result->fetch()) {
+     *     echo $robot["name"];
+     * }
+     *```
+     */
+    public function queryUnbuffered(string! sqlStatement, array! bindParams = [], array! bindTypes = []) -> <ResultInterface> | bool
+    {
+        return this->queryStatement(sqlStatement, bindParams, bindTypes, true);
     }
 
     /**
@@ -847,6 +904,148 @@ abstract class AbstractPdo extends AbstractAdapter
      */
     abstract protected function getDsnDefaults() -> array;
 
+    /**
+     * Returns a prepared statement for the SQL statement. When the statement
+     * cache is enabled, the statement prepared previously for the same SQL is
+     * reused unless a result created with it is still alive, and the least
+     * recently used statement is evicted once the cache is full
+     */
+    protected function getCachedStatement(string! sqlStatement) -> <\PDOStatement>
+    {
+        var cached, result, statement, pdo;
+
+        let pdo                   = <\PDO> this->pdo,
+            this->statementCached = false;
+
+        if this->statementCacheSize < 1 {
+            return pdo->prepare(sqlStatement);
+        }
+
+        if fetch cached, this->statementCache[sqlStatement] {
+            let result = cached[1];
+
+            if result === null || result->get() === null {
+                let statement = cached[0];
+
+                statement->closeCursor();
+
+                /**
+                 * Move the statement to the end of the list
+                 */
+                unset this->statementCache[sqlStatement];
+
+                let this->statementCache[sqlStatement] = [statement, null],
+                    this->statementCached              = true,
+                    this->statementCacheStats["hits"]  = this->statementCacheStats["hits"] + 1;
+
+                return statement;
+            }
+
+            let this->statementCacheStats["misses"] = this->statementCacheStats["misses"] + 1;
+
+            return pdo->prepare(sqlStatement);
+        }
+
+        let statement                           = pdo->prepare(sqlStatement),
+            this->statementCacheStats["misses"] = this->statementCacheStats["misses"] + 1;
+
+        if count(this->statementCache) >= this->statementCacheSize {
+            unset this->statementCache[array_key_first(this->statementCache)];
+
+            let this->statementCacheStats["evictions"] = this->statementCacheStats["evictions"] + 1;
+        }
+
+        let this->statementCache[sqlStatement] = [statement, null];
+
+        return statement;
+    }
+
+    /**
+     * Prepares a statement whose rows are read from an unbuffered cursor. The
+     * drivers that read rows one by one, like SQLite, need nothing else
+     */
+    protected function prepareUnbuffered(string! sqlStatement) -> <\PDOStatement>
+    {
+        return this->pdo->prepare(sqlStatement);
+    }
+
+    /**
+     * Sends a SQL statement returning rows
+     */
+    protected function queryStatement(string! sqlStatement, array! bindParams, array! bindTypes, bool unbuffered) -> <ResultInterface> | bool
+    {
+        var eventsManager, statement, params, types, result, cached;
+
+        let eventsManager = <ManagerInterface> this->eventsManager;
+
+        /**
+         * Execute the beforeQuery event if an EventsManager is available
+         */
+        if typeof eventsManager == "object" {
+            let this->sqlStatement = sqlStatement,
+                this->sqlVariables = bindParams,
+                this->sqlBindTypes = bindTypes;
+
+            if eventsManager->fire("db:beforeQuery", this) === false {
+                return false;
+            }
+        }
+
+        if !empty bindParams {
+            let params = bindParams;
+            let types = bindTypes;
+        } else {
+            let params = [];
+            let types = [];
+        }
+
+        if unbuffered {
+            let this->statementCached = false,
+                statement             = this->prepareUnbuffered(sqlStatement);
+        } else {
+            let statement = this->getCachedStatement(sqlStatement);
+        }
+
+        if unlikely typeof statement != "object" {
+            throw new Exception("Cannot prepare statement");
+        }
+
+        this->prepareRealSql(sqlStatement, bindParams);
+
+        let statement = this->executePrepared(statement, params, types);
+
+        /**
+         * Execute the afterQuery event if an EventsManager is available
+         */
+        if typeof statement == "object" {
+            if typeof eventsManager == "object" {
+                eventsManager->fire("db:afterQuery", this);
+            }
+
+            let result = new ResultPdo(
+                this,
+                statement,
+                sqlStatement,
+                bindParams,
+                bindTypes,
+                unbuffered
+            );
+
+            /**
+             * The cached statement is not reused while the result is alive
+             */
+            if fetch cached, this->statementCache[sqlStatement] {
+                if cached[0] === statement {
+                    let this->statementCache[sqlStatement][1] = \WeakReference::create(result);
+                }
+            }
+
+            return result;
+        }
+
+        return statement;
+    }
+
     /**
      * Constructs the SQL statement (with parameters)
      *
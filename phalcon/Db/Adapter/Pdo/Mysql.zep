@@ -19,6 +19,8 @@ use Phalcon\Db\Index;
 use Phalcon\Db\IndexInterface;
 use Phalcon\Db\Reference;
 use Phalcon\Db\ReferenceInterface;
+use Phalcon\Db\ResultInterface;
+use Throwable;
 
 /**
  * Specific functions for the MySQL database system
@@ -592,6 +594,33 @@ class Mysql extends PdoAdapter
         return referenceObjects;
     }
 
+    /**
+     * Sends a SQL statement returning rows, reading them with an unbuffered
+     * query. No other statement can be sent through the connection until
+     * all the rows are read or the result is released
+     */
+    public function queryUnbuffered(string! sqlStatement, array! bindParams = [], array! bindTypes = []) -> <ResultInterface> | bool
+    {
+        var buffered, exception, pdo, result;
+
+        let pdo      = <\PDO> this->pdo,
+            buffered = pdo->getAttribute(\PDO::MYSQL_ATTR_USE_BUFFERED_QUERY);
+
+        pdo->setAttribute(\PDO::MYSQL_ATTR_USE_BUFFERED_QUERY, false);
+
+        try {
+            let result = parent::queryUnbuffered(sqlStatement, bindParams, bindTypes);
+        } catch Throwable, exception {
+            pdo->setAttribute(\PDO::MYSQL_ATTR_USE_BUFFERED_QUERY, buffered);
+
+            throw exception;
+        }
+
+        pdo->setAttribute(\PDO::MYSQL_ATTR_USE_BUFFERED_QUERY, buffered);
+
+        return result;
+    }
+
     /**
      * Returns PDO adapter DSN defaults as a key-value map.
      */
@@ -690,4 +690,18 @@ class Postgresql extends PdoAdapter
     {
         return [];
     }
+
+    /**
+     * Prepares a statement reading its rows through a server-side cursor, one
+     * by one, instead of loading the whole result in the client memory
+     */
+    protected function prepareUnbuffered(string! sqlStatement) -> <\PDOStatement>
+    {
+        var options;
+
+        let options = [];
+        let options[\PDO::ATTR_CURSOR] = \PDO::CURSOR_SCROLL;
+
+        return this->pdo->prepare(sqlStatement, options);
+    }
 }
@@ -136,6 +136,15 @@ abstract class Dialect implements DialectInterface
         return this->customFunctions;
     }
 
+    /**
+     * Returns the maximum number of placeholders the database system accepts
+     * in a single statement
+     */
+    public function getMaxPlaceholders() -> int
+    {
+        return 65535;
+    }
+
     /**
      * Resolve Column expressions
      *
@@ -405,6 +414,42 @@ abstract class Dialect implements DialectInterface
         return this->escape(table, escapeChar);
     }
 
+    /**
+     * Generates SQL to insert many rows with a single statement. Every row is
+     * a list of placeholders or raw values in the order of the fields
+     *
+     * ```php
+     * $sql = $dialect->insertMultiple(
+     *     "robots",
+     *     ["name", "year"],
+     *     [
+     *         ["?", "?"],
+     *         ["?", "DEFAULT"],
+     *     ]
+     * );
+     *
+     * echo $sql; // INSERT INTO `robots` (`name`, `year`) VALUES (?, ?), (?, DEFAULT)
+     * ```
+     */
+    public function insertMultiple(string! tableName, array! fields, array! rows, string schemaName = null) -> string
+    {
+        var field, row, escapedFields, values;
+
+        let escapedFields = [],
+            values        = [];
+
+        for field in fields {
+            let escapedFields[] = this->escape(field);
+        }
+
+        for row in rows {
+            let values[] = "(" . join(", ", row) . ")";
+        }
+
+        return "INSERT INTO " . this->prepareTable(tableName, schemaName) .
+            " (" . join(", ", escapedFields) . ") VALUES " . join(", ", values);
+    }
+
     /**
      * Generates the SQL for LIMIT clause
      *
@@ -585,6 +630,61 @@ abstract class Dialect implements DialectInterface
         return this->supportsSavePoints();
     }
 
+    /**
+     * Generates SQL to insert many rows with a single statement, updating the
+     * rows conflicting with the given unique columns instead. All the fields
+     * except the conflicting ones are updated by default; when there are no
+     * fields to update the conflicting rows are left untouched
+     *
+     * ```php
+     * $sql = $dialect->upsertMultiple(
+     *     "robots",
+     *     ["id", "name"],
+     *     [
+     *         ["?", "?"],
+     *     ],
+     *     ["id"]
+     * );
+     *
+     * echo $sql; // INSERT INTO "robots" ("id", "name") VALUES (?, ?) ON CONFLICT ("id") DO UPDATE SET "name" = EXCLUDED."name"
+     * ```
+     */
+    public function upsertMultiple(string! tableName, array! fields, array! rows, array! conflictFields, var updateFields = null, string schemaName = null) -> string
+    {
+        var field, escapedField, conflicts, updates;
+
+        if unlikely !count(conflictFields) {
+            throw new Exception(
+                "The conflicting columns are required to upsert rows"
+            );
+        }
+
+        if typeof updateFields != "array" {
+            let updateFields = array_diff(fields, conflictFields);
+        }
+
+        let conflicts = [],
+            updates   = [];
+
+        for field in conflictFields {
+            let conflicts[] = this->escape(field);
+        }
+
+        for field in updateFields {
+            let escapedField = this->escape(field),
+                updates[]    = escapedField . " = EXCLUDED." . escapedField;
+        }
+
+        if !count(updates) {
+            return this->insertMultiple(tableName, fields, rows, schemaName) .
+                " ON CONFLICT (" . join(", ", conflicts) . ") DO NOTHING";
+        }
+
+        return this->insertMultiple(tableName, fields, rows, schemaName) .
+            " ON CONFLICT (" . join(", ", conflicts) . ") DO UPDATE SET " .
+            join(", ", updates);
+    }
+
     /**
      * Returns the size of the column enclosed in parentheses
      */
@@ -823,6 +823,53 @@ class Mysql extends Dialect
         return "TRUNCATE TABLE " . table;
     }
 
+    /**
+     * Generates SQL to insert many rows with a single statement, updating the
+     * rows that conflict with any unique index instead. MySQL resolves the
+     * conflicts on every unique index, so the conflicting columns are only
+     * used to exclude them from the fields to update
+     *
+     * ```php
+     * $sql = $dialect->upsertMultiple(
+     *     "robots",
+     *     ["id", "name"],
+     *     [
+     *         ["?", "?"],
+     *     ],
+     *     ["id"]
+     * );
+     *
+     * echo $sql; // INSERT INTO `robots` (`id`, `name`) VALUES (?, ?) ON DUPLICATE KEY UPDATE `name` = VALUES(`name`)
+     * ```
+     */
+    public function upsertMultiple(string! tableName, array! fields, array! rows, array! conflictFields, var updateFields = null, string schemaName = null) -> string
+    {
+        var field, escapedField, updates;
+
+        if typeof updateFields != "array" {
+            let updateFields = array_diff(fields, conflictFields);
+        }
+
+        let updates = [];
+
+        for field in updateFields {
+            let escapedField = this->escape(field),
+                updates[]    = escapedField . " = VALUES(" . escapedField . ")";
+        }
+
+        /**
+         * Leave the conflicting rows untouched without ignoring other errors
+         * as INSERT IGNORE would
+         */
+        if !count(updates) {
+            let escapedField = this->escape(fields[0]),
+                updates[]    = escapedField . " = " . escapedField;
+        }
+
+        return this->insertMultiple(tableName, fields, rows, schemaName) .
+            " ON DUPLICATE KEY UPDATE " . join(", ", updates);
+    }
+
     /**
      * Generates SQL checking for the existence of a schema.view
      */
@@ -541,6 +541,15 @@ class Sqlite extends Dialect
         return columnSql;
     }
 
+    /**
+     * Returns the maximum number of placeholders in a single statement. This
+     * is the SQLITE_MAX_VARIABLE_NUMBER default before SQLite 3.32
+     */
+    public function getMaxPlaceholders() -> int
+    {
+        return 999;
+    }
+
     /**
      * Generates the SQL to get query list of indexes
      *
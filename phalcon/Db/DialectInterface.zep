@@ -115,12 +115,23 @@ interface DialectInterface
      */
     public function getCustomFunctions() -> array;
 
+    /**
+     * Returns the maximum number of placeholders the database system accepts
+     * in a single statement
+     */
+    public function getMaxPlaceholders() -> int;
+
     /**
      * Transforms an intermediate representation for an expression into a
      * database system valid expression
      */
     public function getSqlExpression(array! expression, string escapeChar = null, array! bindCounts = []) -> string;
 
+    /**
+     * Generates SQL inserting many rows in a single statement
+     */
+    public function insertMultiple(string! tableName, array! fields, array! rows, string schemaName = null) -> string;
+
     /**
      * Generates the SQL for LIMIT clause
      */
@@ -181,6 +192,12 @@ interface DialectInterface
      */
     public function tableOptions(string! table, string schema = null) -> string;
 
+    /**
+     * Generates SQL inserting many rows in a single statement, updating the
+     * rows which conflict with an existing key
+     */
+    public function upsertMultiple(string! tableName, array! fields, array! rows, array! conflictFields, var updateFields = null, string schemaName = null) -> string;
+
     /**
      * Generates SQL checking for the existence of a schema.view
      */
@@ -37,8 +37,11 @@ use Phalcon\Db\Profiler\Item;
  *         }
  *
  *         if ($event->getType() === "afterQuery") {
- *             // Stop the active profile
- *             $profiler->stopProfile();
+ *             // Stop the active profile, recording whether the connection
+ *             // reused a cached prepared statement
+ *             $profiler->stopProfile(
+ *                 $connection->isStatementCached()
+ *             );
  *         }
  *     }
  * );
@@ -94,6 +97,30 @@ class Profiler
         return this->activeProfile;
     }
 
+    /**
+     * Returns the number of SQL statements processed reusing a prepared
+     * statement from the statement cache of the connection
+     */
+    public function getNumberCachedStatements() -> int
+    {
+        var profile, profiles;
+        int number = 0;
+
+        let profiles = this->allProfiles;
+
+        if typeof profiles != "array" {
+            return 0;
+        }
+
+        for profile in profiles {
+            if profile->isStatementCached() {
+                let number++;
+            }
+        }
+
+        return number;
+    }
+
     /**
      * Returns the total number of SQL statements processed
      */
@@ -159,9 +186,16 @@ class Profiler
     }
 
     /**
-     * Stops the active profile
+     * Stops the active profile. Pass whether the statement reused a cached
+     * prepared statement to keep track of the statement cache
+     *
+     *```php
+     * $profiler->stopProfile(
+     *     $connection->isStatementCached()
+     * );
+     *```
      */
-    public function stopProfile() -> <Profiler>
+    public function stopProfile(bool statementCached = false) -> <Profiler>
     {
         var activeProfile, finalTime, initialTime;
 
@@ -169,6 +203,7 @@ class Profiler
             activeProfile = <Item> this->activeProfile;
 
         activeProfile->setFinalTime(finalTime);
+        activeProfile->setStatementCached(statementCached);
 
         let initialTime = activeProfile->getInitialTime(),
             this->totalSeconds = this->totalSeconds + (finalTime - initialTime),
@@ -50,6 +50,13 @@ class Item
      */
     protected sqlVariables { set, get };
 
+    /**
+     * Whether the statement reused a cached prepared statement
+     *
+     * @var bool
+     */
+    protected statementCached = false { set };
+
     /**
      * Returns the total time in seconds spent by the profile
      */
@@ -57,4 +64,12 @@ class Item
     {
         return this->finalTime - this->initialTime;
     }
+
+    /**
+     * Returns whether the statement reused a cached prepared statement
+     */
+    public function isStatementCached() -> bool
+    {
+        return this->statementCached;
+    }
 }
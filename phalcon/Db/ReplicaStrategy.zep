@@ -0,0 +1,327 @@
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+namespace Phalcon\Db;
+
+use Psr\SimpleCache\CacheInterface;
+
+/**
+ * Chooses the read replica used for a query.
+ *
+ * Replicas are picked at random in proportion to their weight (1 when not
+ * set, 0 disables a replica). A replica failing to connect is marked down and
+ * skipped for a backoff interval that doubles on every consecutive failure.
+ * With a cache the down replicas are shared between requests and processes.
+ *
+ * In sticky mode every read following a write goes to the master, for the
+ * rest of the request or for a window of seconds, so that users read their
+ * own writes even when the replicas lag behind.
+ *
+ * The strategy is used by `Phalcon\DataMapper\Pdo\ConnectionLocator` for the
+ * read connections and by `Phalcon\Mvc\Model\Manager` for the services of a
+ * read connection service.
+ *
+ *```php
+ * use Phalcon\Db\ReplicaStrategy;
+ *
+ * $strategy = new ReplicaStrategy(
+ *     [
+ *         "dbReplica1" => 3,
+ *         "dbReplica2" => 1,
+ *     ]
+ * );
+ *
+ * $strategy
+ *     ->setCache($cache)
+ *     ->setSticky(true, 5)
+ * ;
+ *```
+ */
+class ReplicaStrategy
+{
+    /**
+     * Seconds a replica is skipped after its first failure
+     *
+     * @var int
+     */
+    protected backoff = 5;
+
+    /**
+     * @var CacheInterface|null
+     */
+    protected cache = null;
+
+    /**
+     * @var string
+     */
+    protected cachePrefix = "";
+
+    /**
+     * Replicas known by this strategy, as [down until, failures]
+     *
+     * @var array
+     */
+    protected down = [];
+
+    /**
+     * @var float|null
+     */
+    protected lastWrite = null;
+
+    /**
+     * Maximum seconds a replica is skipped
+     *
+     * @var int
+     */
+    protected maxBackoff = 300;
+
+    /**
+     * @var bool
+     */
+    protected sticky = false;
+
+    /**
+     * @var int
+     */
+    protected stickyWindow = 0;
+
+    /**
+     * @var array
+     */
+    protected weights = [];
+
+    /**
+     * Phalcon\Db\ReplicaStrategy constructor
+     */
+    public function __construct(array weights = [], int backoff = 5, int maxBackoff = 300)
+    {
+        var name, weight;
+
+        for name, weight in weights {
+            this->setWeight(name, weight);
+        }
+
+        let this->backoff    = backoff,
+            this->maxBackoff = maxBackoff;
+    }
+
+    /**
+     * Returns the time of the last write, i.e. to keep it in the session
+     */
+    public function getLastWrite() -> float | null
+    {
+        return this->lastWrite;
+    }
+
+    /**
+     * Returns the weights of the replicas
+     */
+    public function getWeights() -> array
+    {
+        return this->weights;
+    }
+
+    /**
+     * Checks whether a replica is marked down
+     */
+    public function isDown(string name) -> bool
+    {
+        var state;
+
+        if !fetch state, this->down[name] {
+            let state = this->loadState(name);
+        }
+
+        return state[0] > time();
+    }
+
+    /**
+     * Marks a replica down, i.e. after a connection error
+     */
+    public function markDown(string name) -> <ReplicaStrategy>
+    {
+        var delay, failures, state;
+
+        if !fetch state, this->down[name] {
+            let state = this->loadState(name);
+        }
+
+        let failures = state[1] + 1,
+            delay    = min(
+                this->maxBackoff,
+                this->backoff * pow(2, min(failures - 1, 16))
+            ),
+            state    = [time() + delay, failures];
+
+        let this->down[name] = state;
+
+        if this->cache !== null {
+            this->cache->set(
+                this->cachePrefix . name,
+                state,
+                delay + this->maxBackoff
+            );
+        }
+
+        return this;
+    }
+
+    /**
+     * Marks a replica up again after a successful connection
+     */
+    public function markUp(string name) -> <ReplicaStrategy>
+    {
+        var state;
+
+        if !fetch state, this->down[name] {
+            let state = this->loadState(name);
+        }
+
+        if state[1] > 0 {
+            let this->down[name] = [0, 0];
+
+            if this->cache !== null {
+                this->cache->delete(this->cachePrefix . name);
+            }
+        }
+
+        return this;
+    }
+
+    /**
+     * Records a write; in sticky mode the following reads use the master
+     */
+    public function recordWrite() -> void
+    {
+        let this->lastWrite = microtime(true);
+    }
+
+    /**
+     * Picks a replica among the names passed, skipping the ones marked down
+     * and the ones with a weight of 0. Returns null when none is available
+     */
+    public function select(array names) -> string | null
+    {
+        var name, weight;
+        array candidates;
+        int total;
+
+        let candidates = [],
+            total      = 0;
+
+        for name in names {
+            if !fetch weight, this->weights[name] {
+                let weight = 1;
+            }
+
+            if weight <= 0 || this->isDown(name) {
+                continue;
+            }
+
+            let candidates[name] = weight,
+                total           += weight;
+        }
+
+        if total === 0 {
+            return null;
+        }
+
+        let total = mt_rand(1, total);
+
+        for name, weight in candidates {
+            let total -= weight;
+
+            if total <= 0 {
+                break;
+            }
+        }
+
+        return (string) name;
+    }
+
+    /**
+     * Shares the down replicas through a cache
+     */
+    public function setCache(<CacheInterface> cache, string prefix = "phalcon-replica-") -> <ReplicaStrategy>
+    {
+        let this->cache       = cache,
+            this->cachePrefix = prefix,
+            this->down        = [];
+
+        return this;
+    }
+
+    /**
+     * Sets the time of the last write, i.e. restored from the session
+     */
+    public function setLastWrite(float lastWrite = null) -> <ReplicaStrategy>
+    {
+        let this->lastWrite = lastWrite;
+
+        return this;
+    }
+
+    /**
+     * Sends the reads following a write to the master, for the rest of the
+     * request or for `window` seconds
+     */
+    public function setSticky(bool sticky, int window = 0) -> <ReplicaStrategy>
+    {
+        let this->sticky       = sticky,
+            this->stickyWindow = window;
+
+        return this;
+    }
+
+    /**
+     * Sets the weight of a replica
+     */
+    public function setWeight(string name, int weight) -> <ReplicaStrategy>
+    {
+        let this->weights[name] = weight;
+
+        return this;
+    }
+
+    /**
+     * Checks whether the reads have to use the master
+     */
+    public function shouldUseMaster() -> bool
+    {
+        if !this->sticky || this->lastWrite === null {
+            return false;
+        }
+
+        return this->stickyWindow <= 0 ||
+            microtime(true) - this->lastWrite < this->stickyWindow;
+    }
+
+    /**
+     * Returns the state of a replica from the cache, if any
+     */
+    private function loadState(string name) -> array
+    {
+        var state;
+
+        let state = null;
+
+        if this->cache !== null {
+            let state = this->cache->get(this->cachePrefix . name);
+        }
+
+        if typeof state !== "array" {
+            let state = [0, 0];
+        }
+
+        let this->down[name] = state;
+
+        return state;
+    }
+}
@@ -80,17 +80,25 @@ class Pdo implements ResultInterface
      */
     protected sqlStatement = null;
 
+    /**
+     * Whether the rows are read from an unbuffered cursor
+     *
+     * @var bool
+     */
+    protected unbuffered = false;
+
     /**
      * Phalcon\Db\Result\Pdo constructor
      */
     public function __construct(<AdapterInterface> connection, <\PDOStatement> result,
-        sqlStatement = null, bindParams = null, bindTypes = null)
+        sqlStatement = null, bindParams = null, bindTypes = null, bool unbuffered = false)
     {
         let this->connection = connection,
             this->pdoStatement = result,
             this->sqlStatement = sqlStatement,
             this->bindParams = bindParams,
-            this->bindTypes = bindTypes;
+            this->bindTypes = bindTypes,
+            this->unbuffered = unbuffered;
     }
 
     /**
@@ -257,6 +265,15 @@ class Pdo implements ResultInterface
         return this->pdoStatement;
     }
 
+    /**
+     * Checks whether the rows are read from an unbuffered cursor, which can
+     * only be traversed forward once
+     */
+    public function isUnbuffered() -> bool
+    {
+        return this->unbuffered;
+    }
+
     /**
      * Gets number of rows returned by a resultset
      *
@@ -0,0 +1,208 @@
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+namespace Phalcon\Di;
+
+use Phalcon\Di;
+use Phalcon\Events\ManagerInterface;
+
+/**
+ * Base class of the containers generated by `Phalcon\Di\Compiler`.
+ *
+ * Every compiled service is built by a generated factory method calling the
+ * constructor directly. No `Phalcon\Di\Service` object is created for it
+ * unless it is requested through `getService()`, `getRaw()` or
+ * `getServices()`. Services registered at runtime take precedence over the
+ * compiled ones.
+ */
+abstract class Compiled extends Di
+{
+    /**
+     * Original definitions of the compiled services
+     *
+     * @var array
+     */
+    protected compiledDefinitions = [];
+
+    /**
+     * Factory method and shared flag of the compiled services
+     *
+     * @var array
+     */
+    protected compiledServices = [];
+
+    /**
+     * Magic method to get or set services using setters/getters
+     */
+    public function __call(string! method, array arguments = []) -> var | null
+    {
+        var possibleService;
+
+        if starts_with(method, "get") {
+            let possibleService = lcfirst(substr(method, 3));
+
+            if isset this->compiledServices[possibleService] {
+                return this->get(possibleService, arguments);
+            }
+        }
+
+        return parent::__call(method, arguments);
+    }
+
+    /**
+     * Attempts to register a service in the services container
+     * Only is successful if a service hasn't been registered previously
+     * with the same name
+     */
+    public function attempt(string! name, definition, bool shared = false) -> <ServiceInterface> | bool
+    {
+        if isset this->compiledServices[name] {
+            return false;
+        }
+
+        return parent::attempt(name, definition, shared);
+    }
+
+    /**
+     * Resolves the service based on its configuration
+     */
+    public function get(string! name, parameters = null) -> var
+    {
+        var compiled, eventsManager, instance, isShared, method;
+
+        if isset this->services[name] {
+            return parent::get(name, parameters);
+        }
+
+        if !fetch compiled, this->compiledServices[name] {
+            return parent::get(name, parameters);
+        }
+
+        let method   = compiled[0],
+            isShared = compiled[1];
+
+        if isShared && fetch instance, this->sharedInstances[name] {
+            return instance;
+        }
+
+        let instance      = null,
+            eventsManager = <ManagerInterface> this->eventsManager;
+
+        /**
+         * Allows for custom creation of instances through the
+         * "di:beforeServiceResolve" event.
+         */
+        if typeof eventsManager == "object" {
+            let instance = eventsManager->fire(
+                "di:beforeServiceResolve",
+                this,
+                [
+                    "name":       name,
+                    "parameters": parameters
+                ]
+            );
+        }
+
+        if typeof instance != "object" {
+            let instance = this->{method}(parameters);
+
+            if isShared {
+                let this->sharedInstances[name] = instance;
+            }
+        }
+
+        if typeof instance == "object" && instance instanceof InjectionAwareInterface {
+            instance->setDI(this);
+        }
+
+        /**
+         * Allows for post creation instance configuration through the
+         * "di:afterServiceResolve" event.
+         */
+        if typeof eventsManager == "object" {
+            eventsManager->fire(
+                "di:afterServiceResolve",
+                this,
+                [
+                    "name":       name,
+                    "parameters": parameters,
+                    "instance":   instance
+                ]
+            );
+        }
+
+        return instance;
+    }
+
+    /**
+     * Returns a service definition without resolving
+     */
+    public function getRaw(string! name) -> var
+    {
+        return this->getService(name)->getDefinition();
+    }
+
+    /**
+     * Returns a Phalcon\Di\Service instance. A compiled service is turned
+     * into a service of the container, which resolves it from then on
+     */
+    public function getService(string! name) -> <ServiceInterface>
+    {
+        var compiled;
+
+        if !isset this->services[name] && fetch compiled, this->compiledServices[name] {
+            let this->services[name] = new Service(
+                this->compiledDefinitions[name],
+                compiled[1]
+            );
+        }
+
+        return parent::getService(name);
+    }
+
+    /**
+     * Return the services registered in the DI
+     */
+    public function getServices() -> <ServiceInterface[]>
+    {
+        var name;
+
+        for name, _ in this->compiledServices {
+            this->getService(name);
+        }
+
+        return this->services;
+    }
+
+    /**
+     * Check whether the DI contains a service by a name
+     */
+    public function has(string! name) -> bool
+    {
+        return isset this->services[name] || isset this->compiledServices[name];
+    }
+
+    /**
+     * Removes a service in the services container
+     * It also removes any shared instance created for the service
+     */
+    public function remove(string! name) -> void
+    {
+        var compiledServices;
+
+        parent::remove(name);
+
+        if isset this->compiledServices[name] {
+            let compiledServices = this->compiledServices;
+            unset compiledServices[name];
+            let this->compiledServices = compiledServices;
+        }
+    }
+}
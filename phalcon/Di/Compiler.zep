@@ -0,0 +1,381 @@
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+namespace Phalcon\Di;
+
+use Phalcon\Helper\Fs;
+
+/**
+ * Phalcon\Di\Compiler
+ *
+ * Generates a container class, extending `Phalcon\Di\Compiled`, with one
+ * factory method per service of a configured container. Class name and
+ * array definitions, including the ones registered by service providers, are
+ * turned into direct constructor, method and property calls. Closures and
+ * object definitions cannot be generated; they are reported by
+ * `getSkippedServices()` and have to be registered on the compiled
+ * container at runtime.
+ *
+ *```php
+ * use Phalcon\Di\Compiler;
+ * use Phalcon\Di\FactoryDefault;
+ *
+ * $compiledPath = "cache/container.php";
+ *
+ * if (!file_exists($compiledPath)) {
+ *     $container = new FactoryDefault();
+ *     $container->register(new DatabaseProvider());
+ *
+ *     $compiler = new Compiler();
+ *     $compiler->dump($container, "App\\CompiledContainer", $compiledPath);
+ * }
+ *
+ * require $compiledPath;
+ *
+ * $container = new \App\CompiledContainer();
+ * $container->setShared(
+ *     "filter",
+ *     function () {
+ *         return (new \Phalcon\Filter\FilterFactory())->newInstance();
+ *     }
+ * );
+ *```
+ */
+class Compiler
+{
+    /**
+     * @var array
+     */
+    protected skippedServices = [];
+
+    /**
+     * Returns the source of a container class for the services of the
+     * container
+     */
+    public function compile(<DiInterface> container, string! className) -> string
+    {
+        var definition, methodName, name, namespaceName, position, service,
+            shortName;
+        array definitions, methods, services;
+        string code;
+
+        if unlikely !preg_match("/^[A-Za-z_][A-Za-z0-9_]*(\\\\[A-Za-z_][A-Za-z0-9_]*)*$/", className) {
+            throw new Exception(
+                "The class name '" . className . "' is not valid"
+            );
+        }
+
+        let definitions           = [],
+            methods               = [],
+            services              = [],
+            this->skippedServices = [],
+            code                  = "";
+
+        for name, service in container->getServices() {
+            let name       = (string) name,
+                definition = service->getDefinition();
+
+            if !this->isExportable(definition) {
+                let this->skippedServices[] = name;
+
+                continue;
+            }
+
+            let methodName = "get" . ucfirst(preg_replace("/[^A-Za-z0-9_]/", "_", name)) . "Service";
+
+            if name === "" || isset methods[methodName] {
+                let methodName = methodName . "_" . count(methods);
+            }
+
+            let code .= this->compileService(
+                container,
+                name,
+                methodName,
+                definition
+            );
+
+            let methods[methodName] = true,
+                definitions[name]   = definition,
+                services[name]      = [methodName, service->isShared()];
+        }
+
+        let code = "class " . className . " extends \\Phalcon\\Di\\Compiled\n{\n" .
+            "    protected $compiledDefinitions = " . var_export(definitions, true) . ";\n\n" .
+            "    protected $compiledServices = " . var_export(services, true) . ";\n" .
+            code .
+            "}\n";
+
+        let position = strrpos(className, "\\");
+
+        if position !== false {
+            let namespaceName = substr(className, 0, position),
+                shortName     = substr(className, position + 1),
+                code          = "namespace " . namespaceName . ";\n\n" . str_replace(
+                    "class " . className . " ",
+                    "class " . shortName . " ",
+                    code
+                );
+        }
+
+        return "<?php\n\n" . code;
+    }
+
+    /**
+     * Writes the container class to a file, which opcache can cache
+     */
+    public function dump(<DiInterface> container, string! className, string! filePath) -> void
+    {
+        if unlikely !Fs::write(filePath, this->compile(container, className)) {
+            throw new Exception(
+                "File '" . filePath . "' cannot be written"
+            );
+        }
+    }
+
+    /**
+     * Returns the services of the last compiled container which have to be
+     * registered at runtime
+     */
+    public function getSkippedServices() -> array
+    {
+        return this->skippedServices;
+    }
+
+    /**
+     * Returns the code resolving a constructor, call or property argument
+     */
+    private function compileArgument(string! name, var position, var argument) -> string
+    {
+        var instanceArguments, type, value;
+
+        if unlikely typeof argument != "array" {
+            throw new Exception(
+                "Service '" . name . "' cannot be compiled. Argument at position " . position . " must be an array"
+            );
+        }
+
+        if unlikely !fetch type, argument["type"] {
+            throw new Exception(
+                "Service '" . name . "' cannot be compiled. Argument at position " . position . " must have a type"
+            );
+        }
+
+        switch type {
+            case "service":
+                if unlikely !fetch value, argument["name"] {
+                    throw new Exception(
+                        "Service '" . name . "' cannot be compiled. Service 'name' is required in parameter on position " . position
+                    );
+                }
+
+                return "$this->get(" . var_export(value, true) . ")";
+
+            case "parameter":
+                if unlikely !fetch value, argument["value"] {
+                    throw new Exception(
+                        "Service '" . name . "' cannot be compiled. Service 'value' is required in parameter on position " . position
+                    );
+                }
+
+                return var_export(value, true);
+
+            case "instance":
+                if unlikely !fetch value, argument["className"] {
+                    throw new Exception(
+                        "Service '" . name . "' cannot be compiled. Service 'className' is required in parameter on position " . position
+                    );
+                }
+
+                if fetch instanceArguments, argument["arguments"] {
+                    return "$this->get(" . var_export(value, true) . ", " . var_export(instanceArguments, true) . ")";
+                }
+
+                return "$this->get(" . var_export(value, true) . ")";
+        }
+
+        throw new Exception(
+            "Service '" . name . "' cannot be compiled. Unknown service type in parameter on position " . position
+        );
+    }
+
+    /**
+     * Returns the comma separated code of a list of arguments
+     */
+    private function compileArguments(string! name, var arguments) -> string
+    {
+        var argument, position;
+        array code;
+
+        if unlikely typeof arguments != "array" {
+            throw new Exception(
+                "Service '" . name . "' cannot be compiled. Arguments must be an array"
+            );
+        }
+
+        let code = [];
+
+        for position, argument in arguments {
+            let code[] = this->compileArgument(name, position, argument);
+        }
+
+        return implode(", ", code);
+    }
+
+    /**
+     * Returns the factory method of a service, mirroring
+     * `Phalcon\Di\Service::resolve()` and `Phalcon\Di\Service\Builder`
+     */
+    private function compileService(
+        <DiInterface> container,
+        string! name,
+        string! methodName,
+        var definition
+    ) -> string {
+        var arguments, call, className, methodPosition, property,
+            propertyName, propertyPosition;
+        string code;
+
+        let code = "\n    protected function " . methodName . "($parameters = null)\n    {\n";
+
+        /**
+         * String definitions are aliases of other services or class names
+         */
+        if typeof definition == "string" {
+            if container->has(definition) {
+                return code .
+                    "        return $this->get(" . var_export(definition, true) . ", $parameters);\n" .
+                    "    }\n";
+            }
+
+            let className = this->getClassName(name, definition);
+
+            return code .
+                "        if (is_array($parameters)) {\n" .
+                "            return new " . className . "(...$parameters);\n" .
+                "        }\n\n" .
+                "        return new " . className . "();\n" .
+                "    }\n";
+        }
+
+        if unlikely typeof definition != "array" || !isset definition["className"] {
+            throw new Exception(
+                "Service '" . name . "' cannot be compiled. Missing 'className' parameter"
+            );
+        }
+
+        let className = this->getClassName(name, definition["className"]),
+            arguments = "";
+
+        if fetch arguments, definition["arguments"] {
+            let arguments = this->compileArguments(name, arguments);
+        }
+
+        let code .= "        if (is_array($parameters)) {\n" .
+            "            $instance = new " . className . "(...$parameters);\n" .
+            "        } else {\n" .
+            "            $instance = new " . className . "(" . arguments . ");\n" .
+            "        }\n";
+
+        if fetch arguments, definition["calls"] {
+            if unlikely typeof arguments != "array" {
+                throw new Exception(
+                    "Service '" . name . "' cannot be compiled. Setter injection parameters must be an array"
+                );
+            }
+
+            for methodPosition, call in arguments {
+                if unlikely typeof call != "array" || !isset call["method"] {
+                    throw new Exception(
+                        "Service '" . name . "' cannot be compiled. The method name is required on position " . methodPosition
+                    );
+                }
+
+                let code .= "        $instance->" . this->getIdentifier(name, call["method"]) . "(";
+
+                if isset call["arguments"] {
+                    let code .= this->compileArguments(name, call["arguments"]);
+                }
+
+                let code .= ");\n";
+            }
+        }
+
+        if fetch arguments, definition["properties"] {
+            if unlikely typeof arguments != "array" {
+                throw new Exception(
+                    "Service '" . name . "' cannot be compiled. Property injection parameters must be an array"
+                );
+            }
+
+            for propertyPosition, property in arguments {
+                if unlikely typeof property != "array" || !isset property["name"] || !isset property["value"] {
+                    throw new Exception(
+                        "Service '" . name . "' cannot be compiled. The property name and value are required on position " . propertyPosition
+                    );
+                }
+
+                let propertyName = this->getIdentifier(name, property["name"]);
+
+                let code .= "        $instance->" . propertyName . " = " .
+                    this->compileArgument(name, propertyPosition, property["value"]) . ";\n";
+            }
+        }
+
+        return code . "\n        return $instance;\n    }\n";
+    }
+
+    /**
+     * Returns the fully qualified name of an existing class
+     */
+    private function getClassName(string! name, var className) -> string
+    {
+        if unlikely typeof className != "string" || !class_exists(className) {
+            throw new Exception(
+                "Service '" . name . "' cannot be compiled. The class does not exist"
+            );
+        }
+
+        return "\\" . ltrim(className, "\\");
+    }
+
+    /**
+     * Checks a method or property name before it is written to the code
+     */
+    private function getIdentifier(string! name, var identifier) -> string
+    {
+        if unlikely typeof identifier != "string" || !preg_match("/^[A-Za-z_][A-Za-z0-9_]*$/", identifier) {
+            throw new Exception(
+                "Service '" . name . "' cannot be compiled. Invalid method or property name"
+            );
+        }
+
+        return identifier;
+    }
+
+    /**
+     * Checks that a definition holds only scalars and arrays
+     */
+    private function isExportable(var value) -> bool
+    {
+        var item;
+
+        if typeof value == "array" {
+            for item in value {
+                if !this->isExportable(item) {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        return value === null || is_scalar(value);
+    }
+}
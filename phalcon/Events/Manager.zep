@@ -40,6 +40,21 @@ class Manager implements ManagerInterface
      */
     protected events = [];
 
+    /**
+     * Type and name of every event type fired
+     *
+     * @var array
+     */
+    protected eventTypes = [];
+
+    /**
+     * Listeners of every type in priority order, built from the queues when
+     * first fired and discarded when a listener is attached or detached
+     *
+     * @var array
+     */
+    protected listeners = [];
+
     /**
      * @var array
      */
@@ -77,6 +92,8 @@ class Manager implements ManagerInterface
 
         // Insert the handler in the queue
         priorityQueue->insert(handler, priority);
+
+        unset this->listeners[eventType];
     }
 
     /**
@@ -140,6 +157,8 @@ class Manager implements ManagerInterface
             }
 
             let this->events[eventType] = newPriorityQueue;
+
+            unset this->listeners[eventType];
         }
     }
 
@@ -149,11 +168,14 @@ class Manager implements ManagerInterface
     public function detachAll(string! type = null) -> void
     {
         if type === null {
-            let this->events = null;
+            let this->events    = null,
+                this->listeners = [];
         } else {
             if isset this->events[type] {
                 unset this->events[type];
             }
+
+            unset this->listeners[type];
         }
     }
 
@@ -187,7 +209,7 @@ class Manager implements ManagerInterface
      */
     public function fire(string! eventType, object source, var data = null, bool cancelable = true)
     {
-        var events, eventParts, type, eventName, event, status, fireEvents;
+        var events, eventParts, type, eventName, event, status;
 
         let events = this->events;
 
@@ -195,13 +217,17 @@ class Manager implements ManagerInterface
             return null;
         }
 
-        // All valid events must have a colon separator
-        if unlikely !memstr(eventType, ":") {
-            throw new Exception("Invalid event type " . eventType);
+        if !fetch eventParts, this->eventTypes[eventType] {
+            // All valid events must have a colon separator
+            if unlikely !memstr(eventType, ":") {
+                throw new Exception("Invalid event type " . eventType);
+            }
+
+            let eventParts = explode(":", eventType),
+                this->eventTypes[eventType] = eventParts;
         }
 
-        let eventParts = explode(":", eventType),
-            type = eventParts[0],
+        let type = eventParts[0],
             eventName = eventParts[1];
 
         let status = null;
@@ -211,23 +237,28 @@ class Manager implements ManagerInterface
             let this->responses = [];
         }
 
+        // Nothing to notify, avoid creating the event
+        if !isset events[type] && !isset events[eventType] {
+            return null;
+        }
+
         // Create the event context
         let event = new Event(eventName, source, data, cancelable);
 
         // Check if events are grouped by type
-        if fetch fireEvents, events[type] {
-            if typeof fireEvents == "object" {
-                // Call the events queue
-                let status = this->fireQueue(fireEvents, event);
-            }
+        if isset events[type] {
+            let status = this->fireListeners(
+                this->getListeners(type),
+                event
+            );
         }
 
         // Check if there are listeners for the event type itself
-        if fetch fireEvents, events[eventType] {
-            if typeof fireEvents == "object" {
-                // Call the events queue
-                let status = this->fireQueue(fireEvents, event);
-            }
+        if isset events[eventType] {
+            let status = this->fireListeners(
+                this->getListeners(eventType),
+                event
+            );
         }
 
         return status;
@@ -240,29 +271,10 @@ class Manager implements ManagerInterface
      */
     final public function fireQueue(<SplPriorityQueue> queue, <EventInterface> event)
     {
-        var status, eventName, data, iterator, source, handler;
-        bool collect, cancelable;
-
-        let status = null;
-
-        // Get the event type
-        let eventName = event->getType();
-
-        if unlikely typeof eventName != "string" {
-            throw new Exception("The event type not valid");
-        }
-
-        // Get the object who triggered the event
-        let source = event->getSource();
-
-        // Get extra data passed to the event
-        let data = event->getData();
-
-        // Tell if the event is cancelable
-        let cancelable = (bool) event->isCancelable();
+        var iterator;
+        array listeners;
 
-        // Responses need to be traced?
-        let collect = (bool) this->collect;
+        let listeners = [];
 
         // We need to clone the queue before iterate over it
         let iterator = clone queue;
@@ -271,46 +283,12 @@ class Manager implements ManagerInterface
         iterator->top();
 
         while iterator->valid() {
-            // Get the current data
-            let handler = iterator->current();
+            let listeners[] = iterator->current();
 
             iterator->next();
-
-            // Only handler objects are valid
-            if unlikely false === this->isValidHandler(handler) {
-                continue;
-            }
-
-            // Check if the event is a closure
-            if handler instanceof Closure || is_callable(handler) {
-                // Call the function in the PHP userland
-                let status = call_user_func_array(
-                    handler,
-                    [event, source, data]
-                );
-            } else {
-                // Check if the listener has implemented an event with the same name
-                if !method_exists(handler, eventName) {
-                    continue;
-                }
-
-                let status = handler->{eventName}(event, source, data);
-            }
-
-            // Trace the response
-            if collect {
-                let this->responses[] = status;
-            }
-
-            if cancelable {
-                // Check if the event was stopped by the user
-                if event->isStopped() {
-                    break;
-                }
-            }
         }
 
-        return status;
+        return this->fireListeners(listeners, event);
     }
 
     /**
@@ -318,16 +296,19 @@ class Manager implements ManagerInterface
      */
     public function getListeners(string! type) -> array
     {
-        var fireEvents, priorityQueue;
-        array listeners;
+        var listeners, priorityQueue;
+
+        if fetch listeners, this->listeners[type] {
+            return listeners;
+        }
 
-        if !fetch fireEvents, this->events[type] {
+        if !fetch priorityQueue, this->events[type] {
             return [];
         }
 
         let listeners = [];
 
-        let priorityQueue = clone fireEvents;
+        let priorityQueue = clone priorityQueue;
 
         priorityQueue->top();
 
@@ -337,6 +318,8 @@ class Manager implements ManagerInterface
             priorityQueue->next();
         }
 
+        let this->listeners[type] = listeners;
+
         return listeners;
     }
 
@@ -374,4 +357,73 @@ class Manager implements ManagerInterface
 
         return true;
     }
+
+    /**
+     * Calls the listeners, sorted by priority, with the event
+     *
+     * @return mixed
+     */
+    protected function fireListeners(array! listeners, <EventInterface> event)
+    {
+        var status, eventName, data, source, handler;
+        bool collect, cancelable;
+
+        let status = null;
+
+        // Get the event type
+        let eventName = event->getType();
+
+        if unlikely typeof eventName != "string" {
+            throw new Exception("The event type not valid");
+        }
+
+        // Get the object who triggered the event
+        let source = event->getSource();
+
+        // Get extra data passed to the event
+        let data = event->getData();
+
+        // Tell if the event is cancelable
+        let cancelable = (bool) event->isCancelable();
+
+        // Responses need to be traced?
+        let collect = (bool) this->collect;
+
+        for handler in listeners {
+            // Only handler objects are valid
+            if unlikely false === this->isValidHandler(handler) {
+                continue;
+            }
+
+            // Check if the event is a closure
+            if handler instanceof Closure || is_callable(handler) {
+                // Call the function in the PHP userland
+                let status = call_user_func_array(
+                    handler,
+                    [event, source, data]
+                );
+            } else {
+                // Check if the listener has implemented an event with the same name
+                if !method_exists(handler, eventName) {
+                    continue;
+                }
+
+                let status = handler->{eventName}(event, source, data);
+            }
+
+            // Trace the response
+            if collect {
+                let this->responses[] = status;
+            }
+
+            if cancelable {
+                // Check if the event was stopped by the user
+                if event->isStopped() {
+                    break;
+                }
+            }
+        }
+
+        return status;
+    }
 }
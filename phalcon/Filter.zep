@@ -13,6 +13,11 @@ namespace Phalcon;
 use Closure;
 use Phalcon\Filter\Exception;
 use Phalcon\Filter\FilterInterface;
+use Phalcon\Filter\Sanitize\Alnum;
+use Phalcon\Filter\Sanitize\Alpha;
+use Phalcon\Filter\Sanitize\Regex;
+use Phalcon\Filter\Sanitize\Remove;
+use Phalcon\Filter\Sanitize\Replace;
 
 /**
  * Lazy loads, stores and exposes sanitizer objects
@@ -227,22 +232,74 @@ class Filter implements FilterInterface
         array sanitizerParams = []
     ) -> array
     {
-        var itemKey, itemValue;
+        var itemKey, itemValue, sanitizerObject = null;
         array arrayValue;
 
+        /**
+         * Sanitizers built on preg_replace/str_replace process a list of
+         * scalars in a single call
+         */
+        if this->has(sanitizerName) {
+            let sanitizerObject = this->get(sanitizerName);
+
+            if (
+                sanitizerObject instanceof Alnum ||
+                sanitizerObject instanceof Alpha ||
+                sanitizerObject instanceof Regex ||
+                sanitizerObject instanceof Remove ||
+                sanitizerObject instanceof Replace
+            ) && this->isScalarList(values) {
+                return call_user_func_array(
+                    sanitizerObject,
+                    array_merge([values], sanitizerParams)
+                );
+            }
+        }
+
         let arrayValue = [];
 
+        /**
+         * The sanitizer is resolved once for all the values; unknown
+         * sanitizers still raise their notice
+         */
+        if sanitizerObject === null {
+            for itemKey, itemValue in values {
+                let arrayValue[itemKey] = this->sanitizer(
+                    itemValue,
+                    sanitizerName,
+                    sanitizerParams
+                );
+            }
+
+            return arrayValue;
+        }
+
         for itemKey, itemValue in values {
-            let arrayValue[itemKey] = this->sanitizer(
-                itemValue,
-                sanitizerName,
-                sanitizerParams
+            let arrayValue[itemKey] = call_user_func_array(
+                sanitizerObject,
+                array_merge([itemValue], sanitizerParams)
             );
         }
 
         return arrayValue;
     }
 
+    /**
+     * Checks that an array does not contain arrays or objects
+     */
+    private function isScalarList(array values) -> bool
+    {
+        var value;
+
+        for value in values {
+            if typeof value == "array" || typeof value == "object" {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
     /**
      * Internal sanitize wrapper for recursion
      */
@@ -22,6 +22,18 @@ class Alpha
      */
     public function __invoke(var input)
     {
+        var filtered;
+
+        /**
+         * Strings are filtered by a byte table in a single pass, clean
+         * strings are returned without a copy
+         */
+        if typeof input == "string" {
+            let filtered = phalcon_filter_alpha(input);
+
+            return filtered;
+        }
+
         return preg_replace("/[^A-Za-z]/", "", input);
     }
 }
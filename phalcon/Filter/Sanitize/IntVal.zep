@@ -22,6 +22,10 @@ class IntVal
      */
     public function __invoke(var input)
     {
+        if typeof input == "integer" {
+            return input;
+        }
+
         return (int) filter_var(input, FILTER_SANITIZE_NUMBER_INT);
     }
 }
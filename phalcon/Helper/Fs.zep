@@ -41,4 +41,51 @@ class Fs
 
         return filename;
     }
+
+    /**
+     * Writes a file through a temporary file renamed over it, so that
+     * concurrent readers never see it partially written. The temporary file
+     * is created next to the file, or in temporaryDir when passed. The opcache
+     * entry of the file is invalidated unless invalidate is false. Returns
+     * false when the file cannot be written
+     *
+     * @param string $path
+     * @param string $contents
+     * @param string $temporaryDir
+     * @param bool   $invalidate
+     *
+     * @return bool
+     */
+    final public static function write(
+        string! path,
+        string! contents,
+        string temporaryDir = null,
+        bool invalidate = true
+    ) -> bool {
+        string temporaryPath;
+
+        if empty temporaryDir {
+            let temporaryPath = path . "." . uniqid("", true) . ".tmp";
+        } else {
+            let temporaryPath = temporaryDir . uniqid("", true) . ".tmp";
+        }
+
+        if unlikely file_put_contents(temporaryPath, contents) === false {
+            return false;
+        }
+
+        if unlikely !rename(temporaryPath, path) {
+            if file_exists(temporaryPath) {
+                unlink(temporaryPath);
+            }
+
+            return false;
+        }
+
+        if invalidate && function_exists("opcache_invalidate") {
+            opcache_invalidate(path, true);
+        }
+
+        return true;
+    }
 }
@@ -54,11 +54,25 @@ class Request extends AbstractInjectionAware implements RequestInterface
      */
     private filterService = null;
 
+    /**
+     * Normalized names of the headers requested with getHeader()
+     *
+     * @var array
+     */
+    private headerNames = [];
+
     /**
      * @var bool
      */
     private httpMethodParameterOverride = false { get, set };
 
+    /**
+     * Decoded JSON bodies, by the associative flag
+     *
+     * @var array
+     */
+    private jsonCache = [];
+
     /**
      * @var array
      */
@@ -70,9 +84,23 @@ class Request extends AbstractInjectionAware implements RequestInterface
     private putCache = null;
 
     /**
-     * @var string
+     * @var string|null
+     */
+    private rawBody = null;
+
+    /**
+     * Values computed from the server array (headers, quality lists)
+     *
+     * @var array
+     */
+    private serverCache = [];
+
+    /**
+     * Server array the cached values were computed from
+     *
+     * @var array|null
      */
-    private rawBody = "";
+    private serverSnapshot = null;
 
     /**
      * @var bool
@@ -340,9 +368,13 @@ class Request extends AbstractInjectionAware implements RequestInterface
     {
         var value, name, server;
 
-        let name = strtoupper(
-            strtr(header, "-", "_")
-        );
+        if !fetch name, this->headerNames[header] {
+            let name = strtoupper(
+                strtr(header, "-", "_")
+            );
+
+            let this->headerNames[header] = name;
+        }
 
         let server = this->getServerArray();
 
@@ -373,9 +405,7 @@ class Request extends AbstractInjectionAware implements RequestInterface
      */
     public function getHeaders() -> array
     {
-        var name, value, authHeaders, server;
-
-        array headers = [];
+        var name, value, authHeaders, headers, server;
 
         array contentHeaders = [
             "CONTENT_TYPE":   true,
@@ -385,6 +415,21 @@ class Request extends AbstractInjectionAware implements RequestInterface
 
         let server = this->getServerArray();
 
+        this->checkServerCache(server);
+
+        /**
+         * The authorization headers are resolved on every call, since they
+         * can be changed by the "request:beforeAuthorizationResolve" event
+         */
+        if fetch headers, this->serverCache["headers"] {
+            return array_merge(
+                headers,
+                this->resolveAuthorizationHeaders()
+            );
+        }
+
+        let headers = [];
+
         for name, value in server {
             // Note: The starts_with uses case insensitive search here
             if starts_with(name, "HTTP_") {
@@ -421,6 +466,8 @@ class Request extends AbstractInjectionAware implements RequestInterface
             }
         }
 
+        let this->serverCache["headers"] = headers;
+
         let authHeaders = this->resolveAuthorizationHeaders();
 
         // Protect for future (child classes) changes
@@ -531,11 +578,12 @@ class Request extends AbstractInjectionAware implements RequestInterface
     }
 
     /**
-     * Gets decoded JSON HTTP raw request body
+     * Gets decoded JSON HTTP raw request body. The body is decoded once, the
+     * same object is returned by later calls
      */
     public function getJsonRawBody(bool associative = false) -> <\stdClass> | array | bool
     {
-        var rawBody;
+        var json, rawBody;
 
         let rawBody = this->getRawBody();
 
@@ -543,7 +591,12 @@ class Request extends AbstractInjectionAware implements RequestInterface
             return false;
         }
 
-        return json_decode(rawBody, associative);
+        if !fetch json, this->jsonCache[(int) associative] {
+            let json = json_decode(rawBody, associative),
+                this->jsonCache[(int) associative] = json;
+        }
+
+        return json;
     }
 
     /**
@@ -664,6 +717,8 @@ class Request extends AbstractInjectionAware implements RequestInterface
     {
         var put, contentType;
 
+        this->checkServerCache(this->getServerArray());
+
         let put = this->putCache;
 
         if null === put {
@@ -726,19 +781,19 @@ class Request extends AbstractInjectionAware implements RequestInterface
      */
     public function getRawBody() -> string
     {
-        var rawBody, contents;
+        var rawBody;
+
+        this->checkServerCache(this->getServerArray());
 
         let rawBody = this->rawBody;
 
-        if empty rawBody {
-            let contents = file_get_contents("php://input");
+        if rawBody === null {
+            let rawBody = (string) file_get_contents("php://input");
 
             /**
              * We need store the read raw body because it can't be read again
              */
-            let this->rawBody = contents;
-
-            return contents;
+            let this->rawBody = rawBody;
         }
 
         return rawBody;
@@ -1355,6 +1410,12 @@ class Request extends AbstractInjectionAware implements RequestInterface
     {
         var returnedParts, parts, part, headerParts, headerPart, split;
 
+        this->checkServerCache(this->getServerArray());
+
+        if fetch returnedParts, this->serverCache[serverIndex][name] {
+            return returnedParts;
+        }
+
         let returnedParts = [];
 
         let parts = preg_split(
@@ -1385,6 +1446,8 @@ class Request extends AbstractInjectionAware implements RequestInterface
             let returnedParts[] = headerParts;
         }
 
+        let this->serverCache[serverIndex][name] = returnedParts;
+
         return returnedParts;
     }
 
@@ -1524,6 +1587,24 @@ class Request extends AbstractInjectionAware implements RequestInterface
         return files;
     }
 
+    /**
+     * Drops the values computed from the server array, and the request body,
+     * when the server array has been replaced (tests, long running servers).
+     * The identity check is cheap while the array is not changed
+     */
+    private function checkServerCache(array server) -> void
+    {
+        if server === this->serverSnapshot {
+            return;
+        }
+
+        let this->serverSnapshot = server,
+            this->serverCache    = [],
+            this->jsonCache      = [],
+            this->putCache       = null,
+            this->rawBody        = null;
+    }
+
     /**
      * Checks the filter service and assigns it to the class parameter
      */
@@ -25,6 +25,7 @@ use Phalcon\Http\Response\Headers;
 use Phalcon\Di\InjectionAwareInterface;
 use Phalcon\Events\EventsAwareInterface;
 use Phalcon\Events\ManagerInterface;
+use Traversable;
 
 /**
  * Part of the HTTP cycle is return responses to the clients.
@@ -67,6 +68,14 @@ class Response implements ResponseInterface, InjectionAwareInterface, EventsAwar
      */
     protected file = null;
 
+    /**
+     * Header and value sent instead of the file, when the web server
+     * delivers it (X-Sendfile, X-Accel-Redirect)
+     *
+     * @var array|null
+     */
+    protected fileOffload = null;
+
     /**
      * @var Headers
      */
@@ -82,6 +91,11 @@ class Response implements ResponseInterface, InjectionAwareInterface, EventsAwar
      */
     protected statusCodes = [];
 
+    /**
+     * @var array|callable|Traversable|null
+     */
+    protected streamedContent = null;
+
     /**
      * Phalcon\Http\Response constructor
      */
@@ -208,6 +222,51 @@ class Response implements ResponseInterface, InjectionAwareInterface, EventsAwar
         return statusCode ? (int) statusCode : null;
     }
 
+    /**
+     * Checks the validators of the response against the conditional request
+     * headers and, when the client copy is still fresh, turns the response
+     * into a "304 Not Modified" without a body. A weak ETag is computed
+     * from the content when no validator was set.
+     *
+     *```php
+     * if ($response->checkNotModified()) {
+     *     // 304, nothing else to send
+     * }
+     *```
+     */
+    public function checkNotModified(bool computeEtag = true) -> bool
+    {
+        var code, content, headers;
+
+        let code    = this->getStatusCode(),
+            headers = this->getHeaders();
+
+        if code !== null && code !== 200 {
+            return false;
+        }
+
+        let content = this->content;
+
+        if computeEtag && typeof content == "string" && content !== "" &&
+            !headers->has("Etag") && !headers->has("Last-Modified") {
+            this->setEtag("W/\"" . sha1(content) . "\"");
+        }
+
+        if !this->isNotModified() {
+            return false;
+        }
+
+        this->setNotModified();
+
+        let this->content         = null,
+            this->streamedContent = null,
+            this->file            = null;
+
+        headers->remove("Content-Length");
+
+        return true;
+    }
+
     /**
      * Checks if a header exists
      *
@@ -232,6 +291,65 @@ class Response implements ResponseInterface, InjectionAwareInterface, EventsAwar
         return this->sent;
     }
 
+    /**
+     * Checks if the client copy of the response is still valid, comparing
+     * the "If-None-Match" and "If-Modified-Since" request headers with the
+     * ETag and Last-Modified of the response. Only GET and HEAD requests
+     * can be answered as not modified.
+     */
+    public function isNotModified() -> bool
+    {
+        var etag, ifModifiedSince, ifNoneMatch, lastModified, method, server,
+            tag;
+
+        let server = _SERVER;
+
+        if !fetch method, server["REQUEST_METHOD"] {
+            let method = "GET";
+        }
+
+        if method !== "GET" && method !== "HEAD" {
+            return false;
+        }
+
+        let etag         = this->getHeaders()->get("Etag"),
+            lastModified = this->getHeaders()->get("Last-Modified");
+
+        /**
+         * If-None-Match takes precedence over If-Modified-Since, and uses
+         * the weak comparison
+         */
+        if fetch ifNoneMatch, server["HTTP_IF_NONE_MATCH"] {
+            if etag === false {
+                return false;
+            }
+
+            if trim(ifNoneMatch) === "*" {
+                return true;
+            }
+
+            let etag = preg_replace("#^W/#", "", trim(etag));
+
+            for tag in explode(",", ifNoneMatch) {
+                if preg_replace("#^W/#", "", trim(tag)) === etag {
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        if lastModified === false || !fetch ifModifiedSince, server["HTTP_IF_MODIFIED_SINCE"] {
+            return false;
+        }
+
+        let lastModified    = strtotime(lastModified),
+            ifModifiedSince = strtotime(ifModifiedSince);
+
+        return lastModified !== false && ifModifiedSince !== false &&
+            lastModified <= ifModifiedSince;
+    }
+
     /**
      * Redirect by HTTP to another action or URL
      *
@@ -346,12 +464,36 @@ class Response implements ResponseInterface, InjectionAwareInterface, EventsAwar
      */
     public function send() -> <ResponseInterface>
     {
-        var content, file;
+        var code, content, file, range = false;
 
         if unlikely this->sent {
             throw new Exception("Response was already sent");
         }
 
+        let code    = this->getStatusCode(),
+            content = this->content,
+            file    = this->file;
+
+        /**
+         * 1xx, 204 and 304 responses never have a body
+         */
+        if code === 204 || code === 304 || (code !== null && code < 200) {
+            this->sendHeaders();
+            this->sendCookies();
+
+            let this->sent = true;
+
+            return this;
+        }
+
+        /**
+         * Files need their status and headers (Content-Range,
+         * Content-Length) to be known before sending the headers
+         */
+        if content == null && this->streamedContent === null && typeof file == "string" && strlen(file) {
+            let range = this->prepareFile(file);
+        }
+
         this->sendHeaders();
 
         this->sendCookies();
@@ -359,16 +501,12 @@ class Response implements ResponseInterface, InjectionAwareInterface, EventsAwar
         /**
          * Output the response body
          */
-        let content = this->content;
-
         if content != null {
             echo content;
-        } else {
-            let file = this->file;
-
-            if typeof file == "string" && strlen(file) {
-                readfile(file);
-            }
+        } elseif this->streamedContent !== null {
+            this->sendStreamedContent();
+        } elseif typeof range == "array" {
+            this->sendFile(file, range[0], range[1]);
         }
 
         let this->sent = true;
@@ -571,10 +709,30 @@ class Response implements ResponseInterface, InjectionAwareInterface, EventsAwar
     }
 
     /**
-     * Sets an attached file to be sent at the end of the request
+     * Sets an attached file to be sent at the end of the request.
+     *
+     * Single byte ranges requested with the "Range" header are answered with
+     * "206 Partial Content". When an offload header is passed (X-Sendfile,
+     * X-Accel-Redirect) the web server sends the file instead of PHP; the
+     * header value is the offload path, or the file path when not passed.
+     *
+     *```php
+     * $response->setFileToSend(
+     *     "/var/www/files/report.pdf",
+     *     null,
+     *     true,
+     *     "X-Accel-Redirect",
+     *     "/protected/report.pdf"
+     * );
+     *```
      */
-    public function setFileToSend(string filePath, attachmentName = null, attachment = true) -> <ResponseInterface>
-    {
+    public function setFileToSend(
+        string filePath,
+        attachmentName = null,
+        attachment = true,
+        string offloadHeader = null,
+        string offloadPath = null
+    ) -> <ResponseInterface> {
         var basePath;
         var basePathEncoding = "ASCII";
 
@@ -608,7 +766,45 @@ class Response implements ResponseInterface, InjectionAwareInterface, EventsAwar
             }
         }
 
-        let this->file = filePath;
+        let this->file        = filePath,
+            this->fileOffload = null;
+
+        if offloadHeader !== null {
+            let this->fileOffload = [
+                offloadHeader,
+                offloadPath !== null ? offloadPath : filePath
+            ];
+        }
+
+        return this;
+    }
+
+    /**
+     * Sets the response body to be sent in chunks, without buffering it.
+     * It accepts an iterable (array, generator, Traversable) or a callable.
+     * The callable receives the response and can either echo the output or
+     * return an iterable. The output is flushed after each chunk.
+     *
+     *```php
+     * $response->setStreamedContent(
+     *     function () use ($rows) {
+     *         foreach ($rows as $row) {
+     *             yield implode(",", $row) . PHP_EOL;
+     *         }
+     *     }
+     * );
+     *```
+     */
+    public function setStreamedContent(var content) -> <ResponseInterface>
+    {
+        if unlikely !(is_callable(content) || typeof content == "array" || content instanceof Traversable) {
+            throw new Exception(
+                "The streamed content must be an iterable or a callable"
+            );
+        }
+
+        let this->content         = null,
+            this->streamedContent = content;
 
         return this;
     }
@@ -858,4 +1054,159 @@ class Response implements ResponseInterface, InjectionAwareInterface, EventsAwar
 
         return this;
     }
+
+    /**
+     * Sends the output to the client. An active output buffer, i.e. from
+     * the output_buffering setting or ob_start(), is flushed first, otherwise
+     * the chunks would stay in memory until the end of the request
+     */
+    protected function flushOutput() -> void
+    {
+        if ob_get_level() > 0 {
+            ob_flush();
+        }
+
+        flush();
+    }
+
+    /**
+     * Sets the headers of the file to send. Returns the offset and length
+     * to output, or false when there is no body to send (offloaded to the
+     * web server, or range not satisfiable)
+     */
+    protected function prepareFile(string! file) -> array | bool
+    {
+        var headers, ifRange, matches, offload, range, server, size;
+        int start, end;
+
+        let headers = this->getHeaders(),
+            offload = this->fileOffload;
+
+        if typeof offload == "array" {
+            headers->set(offload[0], offload[1]);
+
+            return false;
+        }
+
+        let size = filesize(file);
+
+        if size === false {
+            return false;
+        }
+
+        headers->set("Accept-Ranges", "bytes");
+
+        let server = _SERVER;
+
+        if !fetch range, server["HTTP_RANGE"] {
+            let range = "";
+        }
+
+        /**
+         * Only a single range is supported, others get the full file
+         */
+        if !preg_match("/^bytes=(\d*)-(\d*)$/", range, matches) ||
+            (matches[1] === "" && matches[2] === "") {
+            this->setContentLength(size);
+
+            return [0, size];
+        }
+
+        /**
+         * The range only applies if the validator still matches
+         */
+        if fetch ifRange, server["HTTP_IF_RANGE"] {
+            if ifRange !== headers->get("Etag") && ifRange !== headers->get("Last-Modified") {
+                this->setContentLength(size);
+
+                return [0, size];
+            }
+        }
+
+        if matches[1] === "" {
+            let start = size - (int) matches[2],
+                end   = size - 1;
+
+            if start < 0 {
+                let start = 0;
+            }
+        } else {
+            let start = (int) matches[1],
+                end   = matches[2] === "" ? size - 1 : (int) matches[2];
+
+            if end >= size {
+                let end = size - 1;
+            }
+        }
+
+        if start > end || start >= size {
+            this->setStatusCode(416);
+            headers->set("Content-Range", "bytes */" . size);
+
+            return false;
+        }
+
+        this->setStatusCode(206);
+        headers->set(
+            "Content-Range",
+            "bytes " . start . "-" . end . "/" . size
+        );
+        this->setContentLength(end - start + 1);
+
+        return [start, end - start + 1];
+    }
+
+    /**
+     * Outputs part of a file in chunks
+     */
+    protected function sendFile(string! file, int offset, int length) -> void
+    {
+        var chunk, handle;
+
+        let handle = fopen(file, "rb");
+
+        if unlikely handle === false {
+            return;
+        }
+
+        if offset > 0 {
+            fseek(handle, offset);
+        }
+
+        while length > 0 && !feof(handle) {
+            let chunk = fread(handle, length > 8192 ? 8192 : length);
+
+            if chunk === false || chunk === "" {
+                break;
+            }
+
+            echo chunk;
+            this->flushOutput();
+
+            let length -= strlen(chunk);
+        }
+
+        fclose(handle);
+    }
+
+    /**
+     * Outputs the streamed content, flushing each chunk
+     */
+    protected function sendStreamedContent() -> void
+    {
+        var chunk, chunks;
+
+        let chunks = this->streamedContent;
+
+        if typeof chunks != "array" && !(chunks instanceof Traversable) {
+            let chunks = call_user_func(chunks, this);
+        }
+
+        if typeof chunks == "array" || chunks instanceof Traversable {
+            for chunk in chunks {
+                echo chunk;
+                this->flushOutput();
+            }
+        }
+    }
 }
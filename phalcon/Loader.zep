@@ -10,9 +10,13 @@
 
 namespace Phalcon;
 
+use FilesystemIterator;
+use Phalcon\Helper\Fs;
 use Phalcon\Loader\Exception;
 use Phalcon\Events\ManagerInterface;
 use Phalcon\Events\EventsAwareInterface;
+use RecursiveDirectoryIterator;
+use RecursiveIteratorIterator;
 
 /**
  * This component helps to load your project classes automatically based on some
@@ -42,6 +46,21 @@ use Phalcon\Events\EventsAwareInterface;
  */
 class Loader implements EventsAwareInterface
 {
+    /**
+     * Prefix of the APCu entries keeping resolved and missing classes
+     *
+     * @var string|null
+     */
+    protected apcuPrefix = null;
+
+    /**
+     * When true, classes not in the registered classes (class map) are not
+     * searched in the filesystem
+     *
+     * @var bool
+     */
+    protected authoritative = false;
+
     /**
      * @var string|null
      */
@@ -82,6 +101,14 @@ class Loader implements EventsAwareInterface
      */
     protected foundPath = null;
 
+    /**
+     * Position of each namespace prefix, used to find the prefixes of a
+     * class without testing all of them
+     *
+     * @var array|null
+     */
+    protected namespacePositions = null;
+
     /**
      * @var array
      */
@@ -99,7 +126,7 @@ class Loader implements EventsAwareInterface
     {
         var eventsManager, classes, extensions, filePath, ds, fixedDirectory,
             directories, ns, namespaces, nsPrefix, directory, fileName,
-            extension, nsClassName, fileCheckingCallback;
+            extension, nsClassName, fileCheckingCallback, apcuPrefix;
 
         let eventsManager = this->eventsManager;
 
@@ -123,6 +150,45 @@ class Loader implements EventsAwareInterface
             return true;
         }
 
+        /**
+         * In authoritative mode the class map is complete
+         */
+        if this->authoritative {
+            if typeof eventsManager == "object" {
+                eventsManager->fire("loader:afterCheckClass", this, className);
+            }
+
+            return false;
+        }
+
+        /**
+         * Classes resolved by previous requests, or missed (empty path)
+         */
+        let apcuPrefix = this->apcuPrefix;
+
+        if apcuPrefix !== null {
+            let filePath = apcu_fetch(apcuPrefix . className);
+
+            if typeof filePath == "string" {
+                if filePath === "" {
+                    if typeof eventsManager == "object" {
+                        eventsManager->fire("loader:afterCheckClass", this, className);
+                    }
+
+                    return false;
+                }
+
+                if typeof eventsManager == "object" {
+                    let this->foundPath = filePath;
+                    eventsManager->fire("loader:pathFound", this, filePath);
+                }
+
+                require filePath;
+
+                return true;
+            }
+        }
+
         let extensions = this->extensions;
 
         let ds = DIRECTORY_SEPARATOR,
@@ -135,13 +201,8 @@ class Loader implements EventsAwareInterface
 
         let fileCheckingCallback = this->fileCheckingCallback;
 
-        for nsPrefix, directories in namespaces {
-            /**
-             * The class name must start with the current namespace
-             */
-            if !starts_with(className, nsPrefix) {
-                continue;
-            }
+        for nsPrefix in this->getNamespacePrefixes(className) {
+            let directories = namespaces[nsPrefix];
 
             /**
              * Append the namespace separator to the prefix
@@ -188,6 +249,10 @@ class Loader implements EventsAwareInterface
                             );
                         }
 
+                        if apcuPrefix !== null {
+                            apcu_store(apcuPrefix . className, filePath);
+                        }
+
                         /**
                          * Simulate a require
                          */
@@ -247,6 +312,10 @@ class Loader implements EventsAwareInterface
                         eventsManager->fire("loader:pathFound", this, filePath);
                     }
 
+                    if apcuPrefix !== null {
+                        apcu_store(apcuPrefix . className, filePath);
+                    }
+
                     /**
                      * Simulate a require
                      */
@@ -260,6 +329,10 @@ class Loader implements EventsAwareInterface
             }
         }
 
+        if apcuPrefix !== null {
+            apcu_store(apcuPrefix . className, "");
+        }
+
         /**
          * Call 'afterCheckClass' event
          */
@@ -273,6 +346,42 @@ class Loader implements EventsAwareInterface
         return false;
     }
 
+    /**
+     * Scans the registered namespaces and directories and writes the class
+     * map to a PHP file, which opcache keeps in shared memory. The class
+     * names are derived from the paths, as autoLoad() does. Use it with
+     * registerClassMap()
+     *
+     *```php
+     * $loader->dumpClassMap("/app/var/classmap.php");
+     *```
+     */
+    public function dumpClassMap(string! path) -> array
+    {
+        var directories, directory, nsPrefix;
+        array classMap;
+
+        let classMap = [];
+
+        for nsPrefix, directories in this->namespaces {
+            for directory in directories {
+                let classMap = this->scanDirectory(classMap, directory, nsPrefix);
+            }
+        }
+
+        for directory in this->directories {
+            let classMap = this->scanDirectory(classMap, directory, "");
+        }
+
+        if unlikely !Fs::write(path, "<?php return " . var_export(classMap, true) . ";") {
+            throw new Exception(
+                "File '" . path . "' cannot be written"
+            );
+        }
+
+        return classMap;
+    }
+
     /**
      * Get the path the loader is checking for a path
      */
@@ -420,6 +529,28 @@ class Loader implements EventsAwareInterface
         return this;
     }
 
+    /**
+     * Registers the classes of a class map file created by dumpClassMap().
+     * Classes registered with registerClasses() take precedence. In
+     * authoritative mode the classes not in the map are not searched in the
+     * filesystem
+     */
+    public function registerClassMap(string! path, bool authoritative = false) -> <Loader>
+    {
+        var classMap;
+
+        let classMap = require path;
+
+        if unlikely typeof classMap != "array" {
+            throw new Exception("The class map is not valid");
+        }
+
+        let this->classes       = array_merge(classMap, this->classes),
+            this->authoritative = authoritative;
+
+        return this;
+    }
+
     /**
      * Register directories in which "not found" classes could be found
      */
@@ -473,6 +604,38 @@ class Loader implements EventsAwareInterface
             let this->namespaces = preparedNamespaces;
         }
 
+        let this->namespacePositions = null;
+
+        return this;
+    }
+
+    /**
+     * Keeps the resolved and the missing classes in APCu, under a prefix
+     * that should change with each deployment. Pass null to disable it
+     *
+     *```php
+     * $loader->setApcuPrefix("loader-" . $release . "-");
+     *```
+     */
+    public function setApcuPrefix(string prefix = null) -> <Loader>
+    {
+        if prefix !== null && !function_exists("apcu_fetch") {
+            throw new Exception("The APCu extension is not loaded");
+        }
+
+        let this->apcuPrefix = prefix;
+
+        return this;
+    }
+
+    /**
+     * Sets if the class map is complete; classes not in it are not searched
+     * in the filesystem
+     */
+    public function setAuthoritative(bool authoritative) -> <Loader>
+    {
+        let this->authoritative = authoritative;
+
         return this;
     }
 
@@ -546,6 +709,50 @@ class Loader implements EventsAwareInterface
         return this;
     }
 
+    /**
+     * Returns the registered namespaces containing a class, in registration
+     * order. Each parent namespace of the class is looked up, instead of
+     * testing every registered prefix
+     */
+    protected function getNamespacePrefixes(string! className) -> array
+    {
+        var name, position, positions, separator;
+        array prefixes;
+        string prefix;
+
+        if this->namespacePositions === null {
+            let positions = [];
+
+            for position, name in array_keys(this->namespaces) {
+                let positions[trim(name, "\\")] = [position, name];
+            }
+
+            let this->namespacePositions = positions;
+        }
+
+        let positions = this->namespacePositions,
+            prefixes  = [],
+            prefix    = className;
+
+        loop {
+            let separator = strrpos(prefix, "\\");
+
+            if separator === false {
+                break;
+            }
+
+            let prefix = substr(prefix, 0, separator);
+
+            if fetch position, positions[prefix] {
+                let prefixes[position[0]] = position[1];
+            }
+        }
+
+        ksort(prefixes);
+
+        return prefixes;
+    }
+
     protected function prepareNamespace(array! namespaceName) -> array
     {
         var localPaths, name, paths, prepared;
@@ -564,4 +771,50 @@ class Loader implements EventsAwareInterface
 
         return prepared;
     }
+
+    /**
+     * Returns the class map with the classes of a directory added
+     */
+    private function scanDirectory(array classMap, string! directory, string! nsPrefix) -> array
+    {
+        var className, extension, file, files, fixedDirectory, relative;
+
+        let fixedDirectory = rtrim(directory, DIRECTORY_SEPARATOR) . DIRECTORY_SEPARATOR;
+
+        if !is_dir(fixedDirectory) {
+            return classMap;
+        }
+
+        let files = new RecursiveIteratorIterator(
+            new RecursiveDirectoryIterator(
+                fixedDirectory,
+                FilesystemIterator::SKIP_DOTS
+            )
+        );
+
+        for file in iterator_to_array(files) {
+            let extension = file->getExtension();
+
+            if !file->isFile() || !in_array(extension, this->extensions, true) {
+                continue;
+            }
+
+            let relative  = substr(file->getPathname(), strlen(fixedDirectory)),
+                relative  = substr(relative, 0, -(strlen(extension) + 1)),
+                className = str_replace(DIRECTORY_SEPARATOR, "\\", relative);
+
+            if nsPrefix !== "" {
+                let className = trim(nsPrefix, "\\") . "\\" . className;
+            }
+
+            /**
+             * The first match wins, as in autoLoad()
+             */
+            if !isset classMap[className] {
+                let classMap[className] = file->getPathname();
+            }
+        }
+
+        return classMap;
+    }
 }
@@ -33,6 +33,36 @@ use UnexpectedValueException;
  */
 class Stream extends AbstractAdapter
 {
+    /**
+     * Formatted messages waiting to be written
+     *
+     * @var array
+     */
+    protected buffer = [];
+
+    /**
+     * Number of messages kept before writing them. Defaults to 0, writing
+     * every message as it is processed
+     *
+     * @var int
+     */
+    protected bufferSize = 0;
+
+    /**
+     * Time the first message of the buffer was added
+     *
+     * @var int
+     */
+    protected bufferTime = 0;
+
+    /**
+     * Seconds after which the buffered messages are written. Defaults to 0,
+     * writing them only when the buffer is full or the adapter is closed
+     *
+     * @var int
+     */
+    protected flushInterval = 0;
+
     /**
      * Stream handler resource
      *
@@ -65,12 +95,14 @@ class Stream extends AbstractAdapter
      * Constructor. Accepts the name and some options
      *
      * @param array options = [
-     *     'mode' => 'ab'
+     *     'mode'          => 'ab',
+     *     'bufferSize'    => 0,
+     *     'flushInterval' => 0
      * ]
      */
     public function __construct(string! name, array options = [])
     {
-        var mode;
+        var mode, bufferSize, flushInterval;
 
         /**
          * Mode
@@ -87,6 +119,24 @@ class Stream extends AbstractAdapter
 
         let this->name = name,
             this->mode = mode;
+
+        /**
+         * Buffering
+         */
+        if fetch bufferSize, options["bufferSize"] {
+            let this->bufferSize = (int) bufferSize;
+
+            if this->bufferSize > 0 {
+                /**
+                 * The buffer is written at the end of the request
+                 */
+                register_shutdown_function([this, "flush"]);
+            }
+        }
+
+        if fetch flushInterval, options["flushInterval"] {
+            let this->flushInterval = (int) flushInterval;
+        }
     }
 
     /**
@@ -96,6 +146,8 @@ class Stream extends AbstractAdapter
     {
         bool result = true;
 
+        this->flush();
+
         if is_resource(this->handler) {
             let result = fclose(this->handler);
         }
@@ -105,6 +157,23 @@ class Stream extends AbstractAdapter
         return result;
     }
 
+    /**
+     * Writes the buffered messages to the stream with a single write
+     */
+    public function flush() -> bool
+    {
+        var messages;
+
+        if empty this->buffer {
+            return true;
+        }
+
+        let messages     = implode("", this->buffer),
+            this->buffer = [];
+
+        return false !== fwrite(this->getHandler(), messages);
+    }
+
     /**
      * Processes the message i.e. writes it to the file
      */
@@ -112,6 +181,32 @@ class Stream extends AbstractAdapter
     {
         var message;
 
+        let message = this->getFormattedItem(item);
+
+        if this->bufferSize > 0 {
+            if empty this->buffer {
+                let this->bufferTime = time();
+            }
+
+            let this->buffer[] = message;
+
+            if count(this->buffer) >= this->bufferSize || (this->flushInterval > 0 && time() - this->bufferTime >= this->flushInterval) {
+                this->flush();
+            }
+
+            return;
+        }
+
+        fwrite(this->getHandler(), message);
+    }
+
+    /**
+     * Returns the stream handler, opening the stream if needed
+     *
+     * @return resource
+     */
+    protected function getHandler()
+    {
         if !is_resource(this->handler) {
             let this->handler = fopen(this->name, this->mode);
 
@@ -128,8 +223,6 @@ class Stream extends AbstractAdapter
             }
         }
 
-        let message = this->getFormattedItem(item);
-
-        fwrite(this->handler, message);
+        return this->handler;
     }
 }
@@ -10,7 +10,7 @@
 
 namespace Phalcon\Logger\Formatter;
 
-use DateTime;
+use DateTimeImmutable;
 use Phalcon\Logger\Item;
 use Phalcon\Support\Helper\Str\Interpolate;
 
@@ -26,7 +26,23 @@ class Line extends AbstractFormatter
      *
      * @var string
      */
-    protected format { get, set };
+    protected format { get };
+
+    /**
+     * The date of the last formatted item, reused for items logged within the
+     * same second
+     *
+     * @var array
+     */
+    protected lastDate = [];
+
+    /**
+     * The format split in literals and the date, level and message
+     * placeholders
+     *
+     * @var array
+     */
+    protected segments = [];
 
     /**
      * Phalcon\Logger\Formatter\Line construct
@@ -35,8 +51,9 @@ class Line extends AbstractFormatter
         string format = "[%date%][%level%] %message%",
         string dateFormat = "c"
     ) {
-        let this->format     = format,
-            this->dateFormat = dateFormat;
+        let this->dateFormat = dateFormat;
+
+        this->setFormat(format);
     }
 
     /**
@@ -44,17 +61,102 @@ class Line extends AbstractFormatter
      */
     public function format(<Item> item) -> string
     {
-        var context, format, interpolate, time;
+        var context, interpolate, segment, values;
+        string output;
+
+        let values = [
+            "date"    : this->getFormattedDate(item->getTime()),
+            "level"   : item->getLevelName(),
+            "message" : item->getMessage()
+        ];
+
+        /**
+         * Messages with a context may use any placeholder, they are
+         * interpolated as a whole
+         */
+        let context = item->getContext();
+
+        if !empty context {
+            let context["date"]    = values["date"],
+                context["level"]   = values["level"],
+                context["message"] = values["message"],
+                interpolate        = new Interpolate();
+
+            return interpolate->__invoke(this->format, context);
+        }
+
+        let output = "";
+
+        /**
+         * Literals are strings, placeholders are arrays with their name
+         */
+        for segment in this->segments {
+            if typeof segment == "string" {
+                let output .= segment;
+            } else {
+                let output .= values[segment[0]];
+            }
+        }
+
+        return output;
+    }
+
+    /**
+     * Sets the format, splitting it once in literals and the date, level and
+     * message placeholders, matched the same way as the interpolation does
+     */
+    public function setFormat(string format) -> <Line>
+    {
+        var parts, part;
+        int index;
+        array segments;
+
+        let parts = preg_split(
+            "/%(date|level|message)%/",
+            format,
+            -1,
+            PREG_SPLIT_DELIM_CAPTURE
+        );
+
+        let segments = [];
+
+        for index, part in parts {
+            if index % 2 === 1 {
+                let segments[] = [part];
+            } elseif part !== "" {
+                let segments[] = part;
+            }
+        }
+
+        let this->format   = format,
+            this->segments = segments;
+
+        return this;
+    }
+
+    /**
+     * Formats the date of an item, reusing the last formatted date when the
+     * item was logged in the same second, with the same timezone, and the
+     * date format has no fraction of seconds
+     */
+    protected function getFormattedDate(<DateTimeImmutable> time) -> string
+    {
+        var key, date, lastDate;
+
+        if memstr(this->dateFormat, "u") || memstr(this->dateFormat, "v") {
+            return time->format(this->dateFormat);
+        }
+
+        let key      = time->getTimestamp() . ":" . time->getTimezone()->getName() . ":" . this->dateFormat,
+            lastDate = this->lastDate;
 
-        let context     = item->getContext(),
-            format      = this->format,
-            time        = item->getTime(),
-            interpolate = new Interpolate();
+        if isset lastDate[key] {
+            return lastDate[key];
+        }
 
-        let context["date"]    = time->format(this->dateFormat),
-            context["level"]   = item->getLevelName(),
-            context["message"] = item->getMessage();
+        let date           = time->format(this->dateFormat),
+            this->lastDate = [key : date];
 
-        return interpolate->__invoke(format, context);
+        return date;
     }
 }
@@ -13,6 +13,7 @@ namespace Phalcon\Mvc;
 use Closure;
 use Phalcon\Application\AbstractApplication;
 use Phalcon\Di\DiInterface;
+use Phalcon\Http\Response;
 use Phalcon\Http\ResponseInterface;
 use Phalcon\Events\ManagerInterface;
 use Phalcon\Mvc\Application\Exception;
@@ -67,6 +68,11 @@ use Phalcon\Mvc\ModuleDefinitionInterface;
  */
 class Application extends AbstractApplication
 {
+    /**
+     * @var bool
+     */
+    protected conditionalGet = false;
+
     /**
      * @var bool
      */
@@ -345,6 +351,19 @@ class Application extends AbstractApplication
                             let renderStatus = eventsManager->fire("application:viewRender", this, view);
                         }
 
+                        /**
+                         * Validators declared by the controller (ETag,
+                         * Last-Modified) that match the request skip the
+                         * rendering
+                         */
+                        if renderStatus !== false && this->conditionalGet {
+                            let response = container->getShared("response");
+
+                            if response instanceof Response && response->checkNotModified(false) {
+                                let renderStatus = false;
+                            }
+                        }
+
                         /**
                          * Check if the view process has been treated by the
                          * developer
@@ -392,6 +411,14 @@ class Application extends AbstractApplication
             }
         }
 
+        /**
+         * Answer conditional requests with a 304 when the content did not
+         * change
+         */
+        if this->conditionalGet && response instanceof Response {
+            response->checkNotModified();
+        }
+
         /**
          * Calling beforeSendResponse
          */
@@ -440,6 +467,19 @@ class Application extends AbstractApplication
         return this;
     }
 
+    /**
+     * Enables or disables answering conditional GET requests
+     * (If-None-Match, If-Modified-Since) with "304 Not Modified". Controllers
+     * can set the ETag or Last-Modified of the response to skip the view
+     * rendering, otherwise a weak ETag is computed from the content
+     */
+    public function useConditionalGet(bool conditionalGet) -> <Application>
+    {
+        let this->conditionalGet = conditionalGet;
+
+        return this;
+    }
+
     /**
      * By default. The view is implicitly buffering all the output
      * You can full disable the view component using this method
@@ -19,6 +19,7 @@ use Phalcon\Mvc\Micro\Exception;
 use Phalcon\Di\ServiceInterface;
 use Phalcon\Mvc\Micro\Collection;
 use Phalcon\Mvc\Micro\LazyLoader;
+use Phalcon\Http\Response;
 use Phalcon\Http\ResponseInterface;
 use Phalcon\Mvc\Model\BinderInterface;
 use Phalcon\Mvc\Router\RouteInterface;
@@ -56,6 +57,11 @@ class Micro extends Injectable implements ArrayAccess, EventsAwareInterface
      */
     protected activeHandler = null;
 
+    /**
+     * @var bool
+     */
+    protected conditionalGet = false;
+
     /**
      * @var array
      */
@@ -803,6 +809,11 @@ class Micro extends Injectable implements ArrayAccess, EventsAwareInterface
 
                 if !response->isSent() {
                     response->setContent(returnedValue);
+
+                    if this->conditionalGet && response instanceof Response {
+                        response->checkNotModified();
+                    }
+
                     response->send();
                 }
             }
@@ -812,6 +823,10 @@ class Micro extends Injectable implements ArrayAccess, EventsAwareInterface
              */
             if typeof returnedValue == "object" && returnedValue instanceof ResponseInterface {
                 if !returnedValue->isSent() {
+                    if this->conditionalGet && returnedValue instanceof Response {
+                        returnedValue->checkNotModified();
+                    }
+
                     returnedValue->send();
                 }
             }
@@ -1259,4 +1274,16 @@ class Micro extends Injectable implements ArrayAccess, EventsAwareInterface
     {
         let this->stopped = true;
     }
+
+    /**
+     * Enables or disables answering conditional GET requests
+     * (If-None-Match, If-Modified-Since) with "304 Not Modified" when the
+     * handler returns a string or a response
+     */
+    public function useConditionalGet(bool conditionalGet) -> <Micro>
+    {
+        let this->conditionalGet = conditionalGet;
+
+        return this;
+    }
 }
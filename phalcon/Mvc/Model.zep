@@ -11,6 +11,7 @@
 namespace Phalcon\Mvc;
 
 use JsonSerializable;
+use Phalcon\Db\Adapter\AbstractAdapter;
 use Phalcon\Db\Adapter\AdapterInterface;
 use Phalcon\Db\Column;
 use Phalcon\Db\DialectInterface;
@@ -102,6 +103,13 @@ abstract class Model extends AbstractInjectionAware implements EntityInterface,
      */
     protected dirtyRelated = [];
 
+    /**
+     * Aliases of the relations loaded eagerly
+     *
+     * @var array
+     */
+    protected eagerRelated = [];
+
     /**
      * @var array
      */
@@ -1486,6 +1494,29 @@ abstract class Model extends AbstractInjectionAware implements EntityInterface,
      * $transaction2->rollback();
      * ```
      *
+     * ```php
+     * // Load the robots and all their parts with one query per relation
+     * $robots = Robot::find(
+     *     [
+     *         'type = "mechanical"',
+     *         'with' => ['robotsParts', 'robotsParts.parts'],
+     *     ]
+     * );
+     * ```
+     *
+     * ```php
+     * // Stream the robots keeping a single row in memory
+     * $robots = Robot::find(
+     *     [
+     *         'stream' => true,
+     *     ]
+     * );
+     *
+     * foreach ($robots as $robot) {
+     *     echo $robot->name, PHP_EOL;
+     * }
+     * ```
+     *
      * @param array|string|int|null parameters = [
      *     'conditions' => ''
      *     'columns' => '',
@@ -1501,7 +1532,9 @@ abstract class Model extends AbstractInjectionAware implements EntityInterface,
      *         'lifetime' => 3600,
      *         'key' => 'my-find-key'
      *     ],
-     *     'hydration' => null
+     *     'hydration' => null,
+     *     'with' => [],
+     *     'stream' => false
      * ]
      */
     public static function find(var parameters = null) -> <ResultsetInterface>
@@ -1959,7 +1992,7 @@ abstract class Model extends AbstractInjectionAware implements EntityInterface,
              * If the related records are already in cache and the relation is reusable,
              * we return the cached records.
              */
-            if relation->isReusable() && this->isRelationshipLoaded(lowerAlias) {
+            if (relation->isReusable() || isset this->eagerRelated[lowerAlias]) && this->isRelationshipLoaded(lowerAlias) {
                 let result = this->related[lowerAlias];
             } else {
                 /**
@@ -1971,6 +2004,8 @@ abstract class Model extends AbstractInjectionAware implements EntityInterface,
                  * We store relationship objects in the related cache if there were no arguments.
                  */
                 let this->related[lowerAlias] = result;
+
+                unset this->eagerRelated[lowerAlias];
             }
         } else {
             /**
@@ -2005,7 +2040,10 @@ abstract class Model extends AbstractInjectionAware implements EntityInterface,
      */
     public function isRelationshipLoaded(string relationshipAlias) -> bool
     {
-        return isset this->related[strtolower(relationshipAlias)];
+        /**
+         * Eager loaded relations without a match are stored as null
+         */
+        return array_key_exists(strtolower(relationshipAlias), this->related);
     }
 
     /**
@@ -2613,6 +2651,165 @@ abstract class Model extends AbstractInjectionAware implements EntityInterface,
         return success;
     }
 
+    /**
+     * Inserts many records with multi-row INSERT statements instead of one
+     * statement per record. The records can be instances of the model or
+     * arrays of attributes, and are mapped to the table columns through the
+     * models metadata.
+     *
+     * Validation does not run and the generated identity values are not
+     * assigned back to the records. The "beforeSave", "beforeCreate",
+     * "afterCreate" and "afterSave" events are fired for the instances of the
+     * model unless $fireEvents is false
+     *
+     * ```php
+     * Robots::saveBatch(
+     *     [
+     *         [
+     *             "name" => "Astro Boy",
+     *             "year" => 1952,
+     *         ],
+     *         [
+     *             "name" => "Bender",
+     *             "year" => 2999,
+     *         ],
+     *     ],
+     *     false
+     * );
+     * ```
+     */
+    public static function saveBatch(array! records, bool fireEvents = true) -> bool
+    {
+        var attributeField, attributes, automaticAttributes, bindDataTypes,
+            bindType, bindTypes, columnMap, connection, defaultValues, field,
+            fields, identityField, metaData, model, record, row, rows, schema,
+            table, value;
+
+        if !count(records) {
+            return true;
+        }
+
+        let model      = create_instance(get_called_class()),
+            metaData   = model->getModelsMetaData(),
+            connection = model->getWriteConnection();
+
+        if unlikely !(connection instanceof AbstractAdapter) {
+            throw new Exception(
+                "Batch inserts require a connection extending Phalcon\\Db\\Adapter\\AbstractAdapter"
+            );
+        }
+
+        let attributes          = metaData->getAttributes(model),
+            bindDataTypes       = metaData->getBindTypes(model),
+            automaticAttributes = metaData->getAutomaticCreateAttributes(model),
+            defaultValues       = metaData->getDefaultValues(model),
+            identityField       = metaData->getIdentityField(model);
+
+        if globals_get("orm.column_renaming") {
+            let columnMap = metaData->getColumnMap(model);
+        } else {
+            let columnMap = null;
+        }
+
+        /**
+         * Resolve the columns once for all the records
+         */
+        let fields    = [],
+            bindTypes = [];
+
+        for field in attributes {
+            if typeof columnMap == "array" {
+                if unlikely !fetch attributeField, columnMap[field] {
+                    throw new Exception(
+                        "Column '" . field . "' isn't part of the column map"
+                    );
+                }
+            } else {
+                let attributeField = field;
+            }
+
+            if isset automaticAttributes[attributeField] {
+                continue;
+            }
+
+            if unlikely !fetch bindType, bindDataTypes[field] {
+                throw new Exception(
+                    "Column '" . field . "' have not defined a bind data type"
+                );
+            }
+
+            let fields[field] = attributeField,
+                bindTypes[]   = bindType;
+        }
+
+        if fireEvents {
+            for record in records {
+                if typeof record == "object" {
+                    if record->fireEventCancel("beforeSave") === false ||
+                       record->fireEventCancel("beforeCreate") === false {
+                        return false;
+                    }
+                }
+            }
+        }
+
+        let rows = [];
+
+        for record in records {
+            let row = [];
+
+            for field, attributeField in fields {
+                if typeof record == "array" {
+                    if !fetch value, record[attributeField] {
+                        let value = null;
+                    }
+                } elseif typeof record == "object" && record instanceof ModelInterface {
+                    let value = record->readAttribute(attributeField);
+                } else {
+                    throw new Exception(
+                        "The records must be instances of the model or arrays"
+                    );
+                }
+
+                if value === null || (value === "" && field == identityField) {
+                    if field == identityField {
+                        let value = connection->getDefaultIdValue();
+                    } elseif fetch value, defaultValues[field] {
+                        if connection->supportsDefaultValue() {
+                            let value = connection->getDefaultValue();
+                        }
+                    }
+                }
+
+                let row[] = value;
+            }
+
+            let rows[] = row;
+        }
+
+        let table  = model->getSource(),
+            schema = model->getSchema();
+
+        if !empty schema {
+            let table = schema . "." . table;
+        }
+
+        if !connection->insertMultiple(table, rows, array_keys(fields), bindTypes) {
+            return false;
+        }
+
+        if fireEvents {
+            for record in records {
+                if typeof record == "object" {
+                    record->fireEvent("afterCreate");
+                    record->fireEvent("afterSave");
+                }
+            }
+        }
+
+        return true;
+    }
+
 
     /**
      * Serializes the object ignoring connections, services, related objects or
@@ -2754,6 +2951,39 @@ abstract class Model extends AbstractInjectionAware implements EntityInterface,
         );
     }
 
+    /**
+     * Sets the records of a relation loaded in advance, usually by eager
+     * loading the relation for a whole resultset. The records are returned
+     * by getRelated() and the magic properties without querying the
+     * database, even if the relation is not reusable
+     *
+     *```php
+     * $robots = Robots::find(
+     *     [
+     *         "with" => ["robotsParts"],
+     *     ]
+     * );
+     *
+     * foreach ($robots as $robot) {
+     *     var_dump($robot->isRelationshipLoaded("robotsParts")); // true
+     * }
+     *```
+     *
+     * @param string alias
+     * @param \Phalcon\Mvc\Model\ResultsetInterface|ModelInterface|null related
+     */
+    public function setRelated(string! alias, var related) -> <ModelInterface>
+    {
+        var lowerAlias;
+
+        let lowerAlias = strtolower(alias);
+
+        let this->related[lowerAlias]      = related,
+            this->eagerRelated[lowerAlias] = true;
+
+        return this;
+    }
+
     /**
      * Sets the record's old snapshot data.
      * This method is used internally to set old snapshot data when the model
@@ -5222,7 +5452,7 @@ abstract class Model extends AbstractInjectionAware implements EntityInterface,
     private static function getPreparedQuery(var params, var limit = null) -> <Query>
     {
         var builder, bindParams, bindTypes, transaction, cache, manager, query,
-            container;
+            container, stream;
 
         let container = Di::getDefault();
         let manager = <ManagerInterface> container->getShared("modelsManager");
@@ -5270,6 +5500,15 @@ abstract class Model extends AbstractInjectionAware implements EntityInterface,
             query->cache(cache);
         }
 
+        /**
+         * Stream the rows from an unbuffered cursor
+         */
+        if fetch stream, params["stream"] {
+            if query instanceof Query {
+                query->setStreaming((bool) stream);
+            }
+        }
+
         return query;
     }
 
@@ -857,4 +857,32 @@ class Criteria implements CriteriaInterface, InjectionAwareInterface
         return this;
     }
 
+    /**
+     * Sets the relations to load for every record of the resultset with one
+     * query per relation
+     *
+     *```php
+     * $robots = Robots::query()
+     *     ->with(["robotsParts"])
+     *     ->execute();
+     *```
+     *
+     * @param array|string relations
+     */
+    public function with(var relations) -> <CriteriaInterface>
+    {
+        var currentRelations;
+
+        if typeof relations == "string" {
+            let relations = [relations];
+        }
+
+        if fetch currentRelations, this->params["with"] {
+            let relations = array_merge(currentRelations, relations);
+        }
+
+        let this->params["with"] = relations;
+
+        return this;
+    }
 }
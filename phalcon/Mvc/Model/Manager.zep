@@ -11,6 +11,7 @@
 namespace Phalcon\Mvc\Model;
 
 use Phalcon\Db\Adapter\AdapterInterface;
+use Phalcon\Db\ReplicaStrategy;
 use Phalcon\Di\DiInterface;
 use Phalcon\Di\InjectionAwareInterface;
 use Phalcon\Events\EventsAwareInterface;
@@ -19,6 +20,9 @@ use Phalcon\Mvc\ModelInterface;
 use Phalcon\Mvc\Model\Query\Builder;
 use Phalcon\Mvc\Model\Query\BuilderInterface;
 use Phalcon\Mvc\Model\Query\StatusInterface;
+use Phalcon\Mvc\Model\Resultset\Simple;
+use Psr\SimpleCache\CacheInterface;
+use Throwable;
 
 /**
  * Phalcon\Mvc\Model\Manager
@@ -182,6 +186,36 @@ class Manager implements ManagerInterface, InjectionAwareInterface, EventsAwareI
      */
     protected modelVisibility = [];
 
+    /**
+     * Cache storing the intermediate representation of PHQL statements
+     * across requests
+     *
+     * @var CacheInterface|null
+     */
+    protected phqlCache = null;
+
+    /**
+     * Fingerprints of the metadata of the models used by cached statements
+     *
+     * @var array
+     */
+    protected phqlCacheFingerprints = [];
+
+    /**
+     * @var array
+     */
+    protected phqlCacheStats = [
+        "hits":      0,
+        "misses":    0,
+        "writes":    0,
+        "evictions": 0
+    ];
+
+    /**
+     * @var string
+     */
+    protected phqlCacheVersion = "";
+
     /**
      * @var string
      */
@@ -192,6 +226,13 @@ class Manager implements ManagerInterface, InjectionAwareInterface, EventsAwareI
      */
     protected readConnectionServices = [];
 
+    /**
+     * Replica strategies by read connection service
+     *
+     * @var array
+     */
+    protected replicaStrategies = [];
+
     /**
      * @var array
      */
@@ -498,11 +539,63 @@ class Manager implements ManagerInterface, InjectionAwareInterface, EventsAwareI
         let this->readConnectionServices[get_class_lower(model)] = connectionService;
     }
 
+    /**
+     * Sets the strategy picking the replica services used instead of a read
+     * connection service
+     *
+     * ```php
+     * use Phalcon\Db\ReplicaStrategy;
+     *
+     * $manager->setReadConnectionService($robot, "dbRead");
+     *
+     * $manager->setReplicaStrategy(
+     *     "dbRead",
+     *     new ReplicaStrategy(
+     *         [
+     *             "dbReplica1" => 3,
+     *             "dbReplica2" => 1,
+     *         ]
+     *     )
+     * );
+     * ```
+     */
+    public function setReplicaStrategy(string! connectionService, <ReplicaStrategy> strategy) -> void
+    {
+        let this->replicaStrategies[connectionService] = strategy;
+    }
+
+    /**
+     * Returns the replica strategy of a read connection service, if any
+     */
+    public function getReplicaStrategy(string! connectionService) -> <ReplicaStrategy> | null
+    {
+        var strategy;
+
+        if !fetch strategy, this->replicaStrategies[connectionService] {
+            return null;
+        }
+
+        return strategy;
+    }
+
     /**
      * Returns the connection to read data related to a model
      */
     public function getReadConnection(<ModelInterface> model) -> <AdapterInterface>
     {
+        var service, strategy;
+
+        if !empty this->replicaStrategies {
+            let service = this->getConnectionService(
+                model,
+                this->readConnectionServices
+            );
+
+            if fetch strategy, this->replicaStrategies[service] {
+                return this->getReplicaConnection(model, strategy);
+            }
+        }
+
         return this->getConnection(model, this->readConnectionServices);
     }
 
@@ -511,6 +604,19 @@ class Manager implements ManagerInterface, InjectionAwareInterface, EventsAwareI
      */
     public function getWriteConnection(<ModelInterface> model) -> <AdapterInterface>
     {
+        var service, strategy;
+
+        if !empty this->replicaStrategies {
+            let service = this->getConnectionService(
+                model,
+                this->readConnectionServices
+            );
+
+            if fetch strategy, this->replicaStrategies[service] {
+                strategy->recordWrite();
+            }
+        }
+
         return this->getConnection(model, this->writeConnectionServices);
     }
 
@@ -547,6 +653,59 @@ class Manager implements ManagerInterface, InjectionAwareInterface, EventsAwareI
         return connection;
     }
 
+    /**
+     * Returns the connection of a replica picked by the strategy. A replica
+     * failing to connect is marked down and another one is picked; when none
+     * is left the read connection service is used. After a write, a sticky
+     * strategy returns the write connection
+     */
+    protected function getReplicaConnection(<ModelInterface> model, <ReplicaStrategy> strategy) -> <AdapterInterface>
+    {
+        var connection, container, name, names;
+
+        if strategy->shouldUseMaster() {
+            return this->getConnection(model, this->writeConnectionServices);
+        }
+
+        let container = <DiInterface> this->container;
+
+        if unlikely typeof container != "object" {
+            throw new Exception(
+                Exception::containerServiceNotFound(
+                    "the services related to the ORM"
+                )
+            );
+        }
+
+        let names = array_keys(strategy->getWeights());
+
+        loop {
+            let name = strategy->select(names);
+
+            if name === null {
+                return this->getConnection(model, this->readConnectionServices);
+            }
+
+            try {
+                let connection = container->getShared(name);
+            } catch Throwable {
+                strategy->markDown(name);
+
+                let names = array_diff(names, [name]);
+
+                continue;
+            }
+
+            if unlikely typeof connection != "object" {
+                throw new Exception("Invalid injected connection service");
+            }
+
+            strategy->markUp(name);
+
+            return connection;
+        }
+    }
+
     /**
      * Returns the connection service name used to read data related to a model
      */
@@ -1673,6 +1832,195 @@ class Manager implements ManagerInterface, InjectionAwareInterface, EventsAwareI
         return records;
     }
 
+    /**
+     * Loads the given relations of every record in a resultset, running one
+     * query per relation (chunked for large key sets) instead of one query per
+     * record. Nested relations are expressed with dots, e.g. "invoices.items"
+     *
+     *```php
+     * $customers = Customers::find();
+     *
+     * $manager->eagerLoad($customers, ["invoices"]);
+     *```
+     */
+    public function eagerLoad(<ResultsetInterface> resultset, array! relations) -> void
+    {
+        var alias, parts, tree, nested, rows, row, first, modelName, relation,
+            fields, keys, value, links, link, intermediateModel,
+            intermediateFields, intermediateReferencedFields, chunk, builder, base,
+            grouped, column, reverseMap, metaData, targets, target, group;
+        bool single;
+
+        if unlikely !(resultset instanceof Simple) {
+            throw new Exception(
+                "Relations can only be eager loaded in resultsets of complete records"
+            );
+        }
+
+        if !resultset->count() {
+            return;
+        }
+
+        /**
+         * Group nested relations by their first alias
+         */
+        let tree = [];
+
+        for alias in relations {
+            let parts = explode(".", alias, 2);
+
+            if !isset tree[parts[0]] {
+                let tree[parts[0]] = [];
+            }
+
+            if isset parts[1] {
+                let tree[parts[0]][] = parts[1];
+            }
+        }
+
+        /**
+         * Materialize the rows first, so the query is not executed twice
+         */
+        let rows = resultset->toArray(),
+            first = resultset->getFirst();
+
+        if unlikely typeof first != "object" {
+            throw new Exception(
+                "Relations can only be eager loaded in resultsets of complete records"
+            );
+        }
+
+        let modelName = get_class(first),
+            metaData = this->container->getShared("modelsMetadata");
+
+        for alias, nested in tree {
+            let relation = this->getRelationByAlias(modelName, alias);
+
+            if unlikely typeof relation != "object" {
+                throw new Exception(
+                    "There is no defined relations for the model '" .
+                    modelName . "' using alias '" . alias . "'"
+                );
+            }
+
+            let fields = relation->getFields();
+
+            if unlikely typeof fields == "array" {
+                throw new Exception(
+                    "Eager loading of relations with compound keys is not supported"
+                );
+            }
+
+            let keys = [];
+
+            for row in rows {
+                if fetch value, row[fields] {
+                    if value !== null {
+                        let keys[value] = value;
+                    }
+                }
+            }
+
+            let keys = array_values(keys),
+                links = null;
+
+            /**
+             * Through relations resolve the keys of the referenced model from
+             * the intermediate model first
+             */
+            if relation->isThrough() {
+                let intermediateModel = relation->getIntermediateModel(),
+                    intermediateFields = relation->getIntermediateFields(),
+                    intermediateReferencedFields = relation->getIntermediateReferencedFields();
+
+                if unlikely typeof intermediateFields == "array" || typeof intermediateReferencedFields == "array" {
+                    throw new Exception(
+                        "Eager loading of relations with compound keys is not supported"
+                    );
+                }
+
+                let links = [],
+                    targets = [];
+
+                for chunk in array_chunk(keys, 500) {
+                    let builder = this->createBuilder();
+
+                    builder->columns(
+                        [
+                            "eagerParent": "[" . intermediateModel . "].[" . intermediateFields . "]",
+                            "eagerTarget": "[" . intermediateModel . "].[" . intermediateReferencedFields . "]"
+                        ]
+                    );
+                    builder->from(intermediateModel);
+                    builder->inWhere(
+                        "[" . intermediateModel . "].[" . intermediateFields . "]",
+                        chunk
+                    );
+
+                    for link in builder->getQuery()->execute()->toArray() {
+                        let links[link["eagerParent"]][] = link["eagerTarget"],
+                            targets[link["eagerTarget"]] = link["eagerTarget"];
+                    }
+                }
+
+                let keys = array_values(targets);
+            }
+
+            let base = this->getEagerRecords(relation, keys);
+
+            if count(nested) {
+                this->eagerLoad(base, nested);
+            }
+
+            /**
+             * Group the raw rows by the referenced column
+             */
+            let column = relation->getReferencedFields(),
+                reverseMap = metaData->getReverseColumnMap(
+                    this->load(relation->getReferencedModel())
+                );
+
+            if typeof reverseMap == "array" && isset reverseMap[column] {
+                let column = reverseMap[column];
+            }
+
+            let grouped = [];
+
+            for row in base->toArray(false) {
+                let grouped[row[column]][] = row;
+            }
+
+            if typeof links == "array" {
+                let group = [];
+
+                for value, targets in links {
+                    let group[value] = [];
+
+                    for target in targets {
+                        if isset grouped[target] {
+                            let group[value] = array_merge(group[value], grouped[target]);
+                        }
+                    }
+                }
+
+                let grouped = group;
+            }
+
+            switch relation->getType() {
+                case Relation::BELONGS_TO:
+                case Relation::HAS_ONE:
+                case Relation::HAS_ONE_THROUGH:
+                    let single = true;
+                    break;
+
+                default:
+                    let single = false;
+            }
+
+            resultset->setRelated(alias, fields, base, grouped, single);
+        }
+    }
+
     /**
      * Returns a reusable object from the internal list
      */
@@ -1703,6 +2051,115 @@ class Manager implements ManagerInterface, InjectionAwareInterface, EventsAwareI
         let this->reusable = [];
     }
 
+    /**
+     * Returns the cache used to store prepared PHQL statements across
+     * requests
+     */
+    public function getPhqlCache() -> <CacheInterface> | null
+    {
+        return this->phqlCache;
+    }
+
+    /**
+     * Returns the number of hits, misses, writes and evictions of the PHQL
+     * cache. Evictions count the statements dropped because the metadata of
+     * their models changed; entries evicted by the cache backend itself are
+     * not visible here and show up as misses
+     */
+    public function getPhqlCacheStats() -> array
+    {
+        return this->phqlCacheStats;
+    }
+
+    /**
+     * Returns a prepared PHQL statement from the PHQL cache. The returned
+     * array contains the statement "type" and its "intermediate"
+     * representation
+     */
+    public function readPhqlCache(string! phql, bool enableImplicitJoins = true) -> array | null
+    {
+        var cached, fingerprints, key;
+
+        if this->phqlCache === null {
+            return null;
+        }
+
+        let key    = this->getPhqlCacheKey(phql, enableImplicitJoins),
+            cached = this->phqlCache->get(key);
+
+        if typeof cached != "array" {
+            let this->phqlCacheStats["misses"] = this->phqlCacheStats["misses"] + 1;
+
+            return null;
+        }
+
+        /**
+         * Statements prepared with another metadata of their models are
+         * evicted and prepared again
+         */
+        if !fetch fingerprints, cached["metadata"] {
+            let fingerprints = null;
+        }
+
+        if fingerprints !== this->getPhqlCacheFingerprints(cached["intermediate"]) {
+            this->phqlCache->delete(key);
+
+            let this->phqlCacheStats["evictions"] = this->phqlCacheStats["evictions"] + 1,
+                this->phqlCacheStats["misses"]    = this->phqlCacheStats["misses"] + 1;
+
+            return null;
+        }
+
+        let this->phqlCacheStats["hits"] = this->phqlCacheStats["hits"] + 1;
+
+        return cached;
+    }
+
+    /**
+     * Sets a cache to store prepared PHQL statements across requests and
+     * workers, so that statements are not parsed again after a worker is
+     * recycled. Every entry keeps a fingerprint of the metadata and column
+     * map of its models, and is evicted when they change. The version is part
+     * of every key and can be changed to drop every statement, i.e. on deploy
+     *
+     *```php
+     * use Phalcon\Cache;
+     * use Phalcon\Cache\AdapterFactory;
+     * use Phalcon\Storage\SerializerFactory;
+     *
+     * $factory = new AdapterFactory(new SerializerFactory());
+     * $cache   = new Cache($factory->newInstance("apcu"));
+     *
+     * $modelsManager->setPhqlCache($cache, "2021-07-01");
+     *```
+     */
+    public function setPhqlCache(<CacheInterface> phqlCache, string! version = "") -> void
+    {
+        let this->phqlCache = phqlCache,
+            this->phqlCacheVersion = version;
+    }
+
+    /**
+     * Stores a prepared PHQL statement in the PHQL cache
+     */
+    public function writePhqlCache(string! phql, int type, array! intermediate, bool enableImplicitJoins = true) -> void
+    {
+        if this->phqlCache === null {
+            return;
+        }
+
+        this->phqlCache->set(
+            this->getPhqlCacheKey(phql, enableImplicitJoins),
+            [
+                "type":         type,
+                "intermediate": intermediate,
+                "metadata":     this->getPhqlCacheFingerprints(intermediate)
+            ]
+        );
+
+        let this->phqlCacheStats["writes"] = this->phqlCacheStats["writes"] + 1;
+    }
+
     /**
      * Gets belongsTo related records from a model
      */
@@ -2101,6 +2558,126 @@ class Manager implements ManagerInterface, InjectionAwareInterface, EventsAwareI
         return this->lastQuery;
     }
 
+    /**
+     * Returns the fingerprints of the metadata of the models used by an
+     * intermediate representation, computed once per model
+     */
+    protected function getPhqlCacheFingerprints(array intermediate) -> array
+    {
+        var container, fingerprint, metaData, model, modelName, modelNames;
+        array fingerprints, models;
+
+        let container = this->container;
+
+        if typeof container != "object" || !container->has("modelsMetadata") {
+            return [];
+        }
+
+        let models = [];
+
+        if fetch modelName, intermediate["model"] {
+            let models[] = modelName;
+        }
+
+        if fetch modelNames, intermediate["models"] {
+            for modelName in modelNames {
+                let models[] = modelName;
+            }
+        }
+
+        let fingerprints = [];
+
+        for modelName in models {
+            if !fetch fingerprint, this->phqlCacheFingerprints[modelName] {
+                if class_exists(modelName) {
+                    let metaData    = container->getShared("modelsMetadata"),
+                        model       = this->load(modelName),
+                        fingerprint = md5(
+                            serialize(
+                                [
+                                    metaData->readMetaData(model),
+                                    metaData->readColumnMap(model)
+                                ]
+                            )
+                        );
+                } else {
+                    let fingerprint = "";
+                }
+
+                let this->phqlCacheFingerprints[modelName] = fingerprint;
+            }
+
+            let fingerprints[modelName] = fingerprint;
+        }
+
+        return fingerprints;
+    }
+
+    /**
+     * Returns the key of a PHQL statement in the PHQL cache
+     */
+    protected function getPhqlCacheKey(string! phql, bool enableImplicitJoins) -> string
+    {
+        return "phql-" . md5(
+            this->phqlCacheVersion . "|" . this->prefix . "|" . (enableImplicitJoins ? "1" : "0") . "|" . phql
+        );
+    }
+
+    /**
+     * Returns every record of the referenced model of a relation matching the
+     * given keys, querying them in chunks
+     */
+    protected function getEagerRecords(<RelationInterface> relation, array! keys) -> <Simple>
+    {
+        var referencedModel, referencedFields, params, chunks, chunk, builder,
+            records, base, rows;
+
+        let referencedModel = relation->getReferencedModel(),
+            referencedFields = relation->getReferencedFields(),
+            params = relation->getParams(),
+            base = null,
+            rows = [];
+
+        if unlikely typeof referencedFields == "array" {
+            throw new Exception(
+                "Eager loading of relations with compound keys is not supported"
+            );
+        }
+
+        if typeof params != "array" {
+            let params = null;
+        }
+
+        /**
+         * A single query still runs when there are no keys, so the returned
+         * resultset carries the metadata of the referenced model
+         */
+        let chunks = array_chunk(keys, 500);
+
+        if !count(chunks) {
+            let chunks = [[]];
+        }
+
+        for chunk in chunks {
+            let builder = this->createBuilder(params);
+
+            builder->from(referencedModel);
+            builder->inWhere(
+                "[" . referencedModel . "].[" . referencedFields . "]",
+                chunk
+            );
+
+            let records = builder->getQuery()->execute(),
+                rows = array_merge(rows, records->toArray(false));
+
+            if base === null {
+                let base = records;
+            }
+        }
+
+        return base->withRows(rows);
+    }
+
     /**
      * Destroys the current PHQL cache
      */
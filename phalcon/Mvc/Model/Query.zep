@@ -14,6 +14,7 @@ use Phalcon\Db\Column;
 use Phalcon\Db\RawValue;
 use Phalcon\Db\ResultInterface;
 use Phalcon\Db\Adapter\AdapterInterface;
+use Phalcon\Db\Adapter\Pdo\AbstractPdo;
 use Phalcon\Di\DiInterface;
 use Phalcon\Helper\Arr;
 use Phalcon\Mvc\ModelInterface;
@@ -165,6 +166,13 @@ class Query implements QueryInterface, InjectionAwareInterface
      */
     protected sqlAliases = [];
 
+    /**
+     * Whether SELECT rows are streamed from an unbuffered cursor
+     *
+     * @var bool
+     */
+    protected streaming = false;
+
     /**
      * @var array
      */
@@ -205,11 +213,34 @@ class Query implements QueryInterface, InjectionAwareInterface
      */
     protected transaction { get };
 
+    /**
+     * Key identifying the intermediate representation in the SQL cache, null
+     * when the intermediate representation was not produced by parse()
+     *
+     * @var string|null
+     */
+    protected irCacheKey = null;
+
+    /**
+     * Relations to eager load in the resultset
+     *
+     * @var array
+     */
+    protected with = [];
+
     /**
      * @var array|null
      */
     protected static internalPhqlCache;
 
+    /**
+     * SQL statements and hydration plans generated for each intermediate
+     * representation, dialect and connection type
+     *
+     * @var array|null
+     */
+    protected static internalSqlCache;
+
     /**
      * Phalcon\Mvc\Model\Query constructor
      *
@@ -254,7 +285,8 @@ class Query implements QueryInterface, InjectionAwareInterface
      */
     public static function clean() -> void
     {
-        let self::internalPhqlCache = [];
+        let self::internalPhqlCache = [],
+            self::internalSqlCache  = [];
     }
 
     /**
@@ -276,6 +308,10 @@ class Query implements QueryInterface, InjectionAwareInterface
                 throw new Exception("Invalid caching options");
             }
 
+            if unlikely this->streaming {
+                throw new Exception("Streaming resultsets can not be cached");
+            }
+
             /**
              * The user must set a cache key
              */
@@ -307,6 +343,10 @@ class Query implements QueryInterface, InjectionAwareInterface
 
                 result->setIsFresh(false);
 
+                if count(this->with) {
+                    this->loadWith(result);
+                }
+
                 /**
                  * Check if only the first row must be returned
                  */
@@ -404,6 +444,13 @@ class Query implements QueryInterface, InjectionAwareInterface
             cache->set(key, result, lifetime);
         }
 
+        /**
+         * Load the relations of every record in the resultset
+         */
+        if type == PHQL_T_SELECT && count(this->with) {
+            this->loadWith(result);
+        }
+
         /**
          * Check if only the first row must be returned
          */
@@ -524,6 +571,23 @@ class Query implements QueryInterface, InjectionAwareInterface
         return this->uniqueRow;
     }
 
+    /**
+     * Returns the relations to eager load
+     */
+    public function getWith() -> array
+    {
+        return this->with;
+    }
+
+    /**
+     * Checks whether the rows of SELECT statements are streamed from an
+     * unbuffered cursor
+     */
+    public function isStreaming() -> bool
+    {
+        return this->streaming;
+    }
+
     /**
      * Parses the intermediate code produced by Phalcon\Mvc\Model\Query\Lang
      * generating another intermediate representation that could be executed by
@@ -531,7 +595,8 @@ class Query implements QueryInterface, InjectionAwareInterface
      */
     public function parse() -> array
     {
-        var intermediate, phql, ast, irPhql, uniqueId, type;
+        var intermediate, phql, ast, irPhql, uniqueId, type, manager, cached;
+        bool persistent;
 
         let intermediate = this->intermediate;
 
@@ -539,11 +604,30 @@ class Query implements QueryInterface, InjectionAwareInterface
             return intermediate;
         }
 
+        let phql = this->phql,
+            manager = this->manager,
+            persistent = false,
+            this->irCacheKey = (this->enableImplicitJoins ? "1" : "0") . phql;
+
+        /**
+         * Check if the prepared PHQL is stored in the persistent cache, this
+         * avoids parsing the statement at all
+         */
+        if manager instanceof Manager && manager->getPhqlCache() !== null {
+            let persistent = true,
+                cached = manager->readPhqlCache(phql, this->enableImplicitJoins);
+
+            if typeof cached == "array" {
+                let this->type = cached["type"];
+
+                return cached["intermediate"];
+            }
+        }
+
         /**
          * This function parses the PHQL statement
          */
-        let phql = this->phql,
-            ast = Lang::parsePHQL(phql);
+        let ast = Lang::parsePHQL(phql);
 
         let irPhql = null,
             uniqueId = null;
@@ -559,6 +643,15 @@ class Query implements QueryInterface, InjectionAwareInterface
                         // Assign the type to the query
                         let this->type = ast["type"];
 
+                        if persistent {
+                            manager->writePhqlCache(
+                                phql,
+                                this->type,
+                                irPhql,
+                                this->enableImplicitJoins
+                            );
+                        }
+
                         return irPhql;
                     }
                 }
@@ -607,6 +700,15 @@ class Query implements QueryInterface, InjectionAwareInterface
             let self::internalPhqlCache[uniqueId] = irPhql;
         }
 
+        if persistent {
+            manager->writePhqlCache(
+                phql,
+                this->type,
+                irPhql,
+                this->enableImplicitJoins
+            );
+        }
+
         let this->intermediate = irPhql;
 
         return irPhql;
@@ -681,7 +783,8 @@ class Query implements QueryInterface, InjectionAwareInterface
      */
     public function setIntermediate(array! intermediate) -> <QueryInterface>
     {
-        let this->intermediate = intermediate;
+        let this->intermediate = intermediate,
+            this->irCacheKey   = null;
 
         return this;
     }
@@ -696,6 +799,28 @@ class Query implements QueryInterface, InjectionAwareInterface
         return this;
     }
 
+    /**
+     * Streams the rows of SELECT statements from an unbuffered cursor (a
+     * server-side cursor in PostgreSQL). The resultset keeps a single row in
+     * memory and can only be traversed forward once
+     *
+     *```php
+     * $robots = $manager->createQuery("SELECT * FROM Robots")
+     *     ->setStreaming(true)
+     *     ->execute();
+     *
+     * foreach ($robots as $robot) {
+     *     echo $robot->name, PHP_EOL;
+     * }
+     *```
+     */
+    public function setStreaming(bool streaming = true) -> <QueryInterface>
+    {
+        let this->streaming = streaming;
+
+        return this;
+    }
+
     /**
      * allows to wrap a transaction around all queries
      */
@@ -727,6 +852,17 @@ class Query implements QueryInterface, InjectionAwareInterface
         return this;
     }
 
+    /**
+     * Sets the relations to load for every record of the resultset with one
+     * query per relation, instead of one query per record
+     */
+    public function setWith(array! with) -> <QueryInterface>
+    {
+        let this->with = with;
+
+        return this;
+    }
+
     /**
      * Executes the DELETE intermediate representation producing a
      * Phalcon\Mvc\Model\Query\Status
@@ -965,7 +1101,7 @@ class Query implements QueryInterface, InjectionAwareInterface
             columnAlias, sqlAlias, dialect, sqlSelect, bindCounts, processed,
             wildcard, value, processedTypes, typeWildcard, result, resultData,
             cache, resultObject, columns1, typesColumnMap, wildcardValue,
-            resultsetClassName;
+            resultsetClassName, cacheKey, plan, planColumns;
         bool haveObjects, haveScalars, isComplex, isSimpleStd,
             isKeepingSnapshots;
         int numberObjects;
@@ -1004,189 +1140,265 @@ class Query implements QueryInterface, InjectionAwareInterface
             }
         }
 
-        let columns = intermediate["columns"];
+        let processed  = [],
+            bindCounts = [];
 
-        let haveObjects = false,
-            haveScalars = false,
-            isComplex = false;
+        /**
+         * Replace the placeholders
+         */
+        for wildcard, value in bindParams {
+            if typeof wildcard == "integer" {
+                let wildcardValue = ":" . wildcard;
+            } else {
+                let wildcardValue = wildcard;
+            }
 
-        // Check if the resultset have objects and how many of them have
-        let numberObjects = 0;
-        let columns1 = columns;
+            let processed[wildcardValue] = value;
 
-        for column in columns {
-            if unlikely typeof column != "array" {
-                throw new Exception("Invalid column definition");
+            if typeof value == "array" {
+                let bindCounts[wildcardValue] = count(value);
             }
+        }
 
-            if column["type"] == "scalar" {
-                if !isset column["balias"] {
-                    let isComplex = true;
-                }
+        let processedTypes = [];
 
-                let haveScalars = true;
+        /**
+         * Replace the bind Types
+         */
+        for typeWildcard, value in bindTypes {
+            if typeof typeWildcard == "integer" {
+                let processedTypes[":" . typeWildcard] = value;
             } else {
-                let haveObjects = true,
-                    numberObjects++;
+                let processedTypes[typeWildcard] = value;
             }
         }
 
-        // Check if the resultset to return is complex or simple
-        if !isComplex {
-            if haveObjects {
-                if haveScalars {
-                    let isComplex = true;
-                } else {
-                    if numberObjects == 1 {
-                        let isSimpleStd = false;
-                    } else {
-                        let isComplex = true;
-                    }
-                }
-            } else {
-                let isSimpleStd = true;
-            }
+        if count(bindCounts) {
+            let intermediate["bindCounts"] = bindCounts;
         }
 
-        // Processing selected columns
-        let instance = null,
-            selectColumns = [],
-            simpleColumnMap = [],
-            metaData = this->metaData;
+        let metaData = this->metaData,
+            dialect  = connection->getDialect(),
+            cacheKey = this->getSqlCacheKey(connection, dialect, models, bindCounts);
 
-        for aliasCopy, column in columns {
-            let sqlColumn = column["column"];
+        /**
+         * Reuse the SQL statement and the hydration plan generated by a
+         * previous execution of the same intermediate representation
+         */
+        if cacheKey !== null && fetch plan, self::internalSqlCache[cacheKey] {
+            let sqlSelect       = plan["sql"],
+                isComplex       = plan["isComplex"],
+                isSimpleStd     = plan["isSimpleStd"],
+                columns1        = plan["columns"],
+                simpleColumnMap = plan["simpleColumnMap"],
+                instance        = null;
 
-            // Complete objects are treated in a different way
-            if column["type"] == "object" {
-                let modelName = column["model"];
+            /**
+             * The plan holds no model instances, they are loaded through the
+             * current models manager
+             */
+            if plan["modelName"] !== null {
+                let modelName = plan["modelName"];
 
-                /**
-                 * Base instance
-                 */
                 if !fetch instance, this->modelsInstances[modelName] {
                     let instance = manager->load(modelName),
                         this->modelsInstances[modelName] = instance;
                 }
+            }
 
-                let attributes = metaData->getAttributes(instance);
+            if isComplex {
+                for aliasCopy, column in columns1 {
+                    if column["type"] != "object" {
+                        continue;
+                    }
 
-                if isComplex {
-                    /**
-                     * If the resultset is complex we open every model into
-                     * their columns
-                     */
-                    if globals_get("orm.column_renaming") {
-                        let columnMap = metaData->getColumnMap(instance);
-                    } else {
-                        let columnMap = null;
+                    let modelName = column["model"];
+
+                    if !fetch instance, this->modelsInstances[modelName] {
+                        let instance = manager->load(modelName),
+                            this->modelsInstances[modelName] = instance;
                     }
 
-                    // Add every attribute in the model to the generated select
-                    for attribute in attributes {
-                        let selectColumns[] = [
-                            attribute,
-                            sqlColumn,
-                            "_" . sqlColumn . "_" . attribute
-                        ];
+                    let columns1[aliasCopy]["instance"] = instance;
+
+                    if manager->isKeepingSnapshots(instance) {
+                        let columns1[aliasCopy]["keepSnapshots"] = true;
+                    }
+                }
+            }
+        } else {
+            let columns = intermediate["columns"];
+
+            let haveObjects = false,
+                haveScalars = false,
+                isComplex = false,
+                isSimpleStd = false;
+
+            // Check if the resultset have objects and how many of them have
+            let numberObjects = 0;
+            let columns1 = columns;
+
+            for column in columns {
+                if unlikely typeof column != "array" {
+                    throw new Exception("Invalid column definition");
+                }
+
+                if column["type"] == "scalar" {
+                    if !isset column["balias"] {
+                        let isComplex = true;
                     }
 
+                    let haveScalars = true;
+                } else {
+                    let haveObjects = true,
+                        numberObjects++;
+                }
+            }
+
+            // Check if the resultset to return is complex or simple
+            if !isComplex {
+                if haveObjects {
+                    if haveScalars {
+                        let isComplex = true;
+                    } else {
+                        if numberObjects == 1 {
+                            let isSimpleStd = false;
+                        } else {
+                            let isComplex = true;
+                        }
+                    }
+                } else {
+                    let isSimpleStd = true;
+                }
+            }
+
+            // Processing selected columns
+            let instance = null,
+                modelName = null,
+                selectColumns = [],
+                simpleColumnMap = [];
+
+            for aliasCopy, column in columns {
+                let sqlColumn = column["column"];
+
+                // Complete objects are treated in a different way
+                if column["type"] == "object" {
+                    let modelName = column["model"];
+
                     /**
-                     * We cache required meta-data to make its future access
-                     * faster
+                     * Base instance
                      */
-                    let columns1[aliasCopy]["instance"]   = instance,
-                        columns1[aliasCopy]["attributes"] = attributes,
-                        columns1[aliasCopy]["columnMap"]  = columnMap;
-
-                    // Check if the model keeps snapshots
-                    let isKeepingSnapshots = (bool) manager->isKeepingSnapshots(instance);
-                    if isKeepingSnapshots {
-                        let columns1[aliasCopy]["keepSnapshots"] = isKeepingSnapshots;
+                    if !fetch instance, this->modelsInstances[modelName] {
+                        let instance = manager->load(modelName),
+                            this->modelsInstances[modelName] = instance;
+                    }
+
+                    let attributes = metaData->getAttributes(instance);
+
+                    if isComplex {
+                        /**
+                         * If the resultset is complex we open every model into
+                         * their columns
+                         */
+                        if globals_get("orm.column_renaming") {
+                            let columnMap = metaData->getColumnMap(instance);
+                        } else {
+                            let columnMap = null;
+                        }
+
+                        // Add every attribute in the model to the generated select
+                        for attribute in attributes {
+                            let selectColumns[] = [
+                                attribute,
+                                sqlColumn,
+                                "_" . sqlColumn . "_" . attribute
+                            ];
+                        }
+
+                        /**
+                         * We cache required meta-data to make its future access
+                         * faster
+                         */
+                        let columns1[aliasCopy]["instance"]   = instance,
+                            columns1[aliasCopy]["attributes"] = attributes,
+                            columns1[aliasCopy]["columnMap"]  = columnMap;
+
+                        // Check if the model keeps snapshots
+                        let isKeepingSnapshots = (bool) manager->isKeepingSnapshots(instance);
+                        if isKeepingSnapshots {
+                            let columns1[aliasCopy]["keepSnapshots"] = isKeepingSnapshots;
+                        }
+                    } else {
+                        /**
+                         * Query only the columns that are registered as attributes
+                         * in the metaData
+                         */
+                        for attribute in attributes {
+                            let selectColumns[] = [attribute, sqlColumn];
+                        }
                     }
                 } else {
                     /**
-                     * Query only the columns that are registered as attributes
-                     * in the metaData
+                     * Create an alias if the column doesn't have one
                      */
-                    for attribute in attributes {
-                        let selectColumns[] = [attribute, sqlColumn];
+                    if typeof aliasCopy == "int" {
+                        let columnAlias = [sqlColumn, null];
+                    } else {
+                        let columnAlias = [sqlColumn, null, aliasCopy];
                     }
+
+                    let selectColumns[] = columnAlias;
                 }
-            } else {
+
                 /**
-                 * Create an alias if the column doesn't have one
+                 * Simulate a column map
                  */
-                if typeof aliasCopy == "int" {
-                    let columnAlias = [sqlColumn, null];
-                } else {
-                    let columnAlias = [sqlColumn, null, aliasCopy];
+                if !isComplex && isSimpleStd {
+                    if fetch sqlAlias, column["sqlAlias"] {
+                        let simpleColumnMap[sqlAlias] = aliasCopy;
+                    } else {
+                        let simpleColumnMap[aliasCopy] = aliasCopy;
+                    }
                 }
-
-                let selectColumns[] = columnAlias;
             }
 
+            let intermediate["columns"] = selectColumns;
+
             /**
-             * Simulate a column map
+             * The corresponding SQL dialect generates the SQL statement based
+             * accordingly with the database system
              */
-            if !isComplex && isSimpleStd {
-                if fetch sqlAlias, column["sqlAlias"] {
-                    let simpleColumnMap[sqlAlias] = aliasCopy;
-                } else {
-                    let simpleColumnMap[aliasCopy] = aliasCopy;
-                }
-            }
-        }
-
-        let processed               = [],
-            bindCounts              = [],
-            intermediate["columns"] = selectColumns;
+            let sqlSelect = dialect->select(intermediate);
 
-        /**
-         * Replace the placeholders
-         */
-        for wildcard, value in bindParams {
-            if typeof wildcard == "integer" {
-                let wildcardValue = ":" . wildcard;
-            } else {
-                let wildcardValue = wildcard;
+            if this->sharedLock {
+                let sqlSelect = dialect->sharedLock(sqlSelect);
             }
 
-            let processed[wildcardValue] = value;
+            if cacheKey !== null {
+                /**
+                 * Model instances are bound to the container and the models
+                 * manager running the query, only the scalar plan is cached
+                 */
+                let planColumns = [];
 
-            if typeof value == "array" {
-                let bindCounts[wildcardValue] = count(value);
-            }
-        }
+                for aliasCopy, column in columns1 {
+                    unset column["instance"];
+                    unset column["keepSnapshots"];
 
-        let processedTypes = [];
+                    let planColumns[aliasCopy] = column;
+                }
 
-        /**
-         * Replace the bind Types
-         */
-        for typeWildcard, value in bindTypes {
-            if typeof typeWildcard == "integer" {
-                let processedTypes[":" . typeWildcard] = value;
-            } else {
-                let processedTypes[typeWildcard] = value;
+                let self::internalSqlCache[cacheKey] = [
+                    "sql":             sqlSelect,
+                    "isComplex":       isComplex,
+                    "isSimpleStd":     isSimpleStd,
+                    "columns":         planColumns,
+                    "simpleColumnMap": simpleColumnMap,
+                    "modelName":       modelName
+                ];
             }
         }
 
-        if count(bindCounts) {
-            let intermediate["bindCounts"] = bindCounts;
-        }
-
-        /**
-         * The corresponding SQL dialect generates the SQL statement based
-         * accordingly with the database system
-         */
-        let dialect   = connection->getDialect(),
-            sqlSelect = dialect->select(intermediate);
-
-        if this->sharedLock {
-            let sqlSelect = dialect->sharedLock(sqlSelect);
-        }
-
         /**
          * Return the SQL to be executed instead of execute it
          */
@@ -1201,7 +1413,17 @@ class Query implements QueryInterface, InjectionAwareInterface
         /**
          * Execute the query
          */
-        let result = connection->query(sqlSelect, processed, processedTypes);
+        if this->streaming {
+            if unlikely !(connection instanceof AbstractPdo) {
+                throw new Exception(
+                    "Streaming resultsets require a PDO connection"
+                );
+            }
+
+            let result = connection->queryUnbuffered(sqlSelect, processed, processedTypes);
+        } else {
+            let result = connection->query(sqlSelect, processed, processedTypes);
+        }
 
         /**
          * Check if the query has data
@@ -3066,6 +3288,65 @@ class Query implements QueryInterface, InjectionAwareInterface
     }
 
 
+    /**
+     * Returns the key of the SQL statement generated for the current
+     * intermediate representation, or null if it cannot be cached
+     */
+    protected function getSqlCacheKey(<AdapterInterface> connection, <DialectInterface> dialect, array models, array bindCounts) -> string | null
+    {
+        var manager, model, modelName;
+        string sources;
+
+        if this->irCacheKey === null {
+            return null;
+        }
+
+        /**
+         * The generated SQL depends on the prefix and the sources the
+         * models manager maps the models to
+         */
+        let manager = this->manager,
+            sources = "";
+
+        if manager instanceof Manager {
+            let sources = manager->getModelPrefix();
+        }
+
+        for modelName in models {
+            let model    = this->modelsInstances[modelName],
+                sources .= "|" . manager->getModelSchema(model) . "." . manager->getModelSource(model);
+        }
+
+        return md5(
+            sources . "|" .
+            get_class(dialect) . "|" .
+            connection->getType() . "|" .
+            (this->sharedLock ? "1" : "0") .
+            (globals_get("db.escape_identifiers") ? "1" : "0") .
+            (globals_get("orm.column_renaming") ? "1" : "0") . "|" .
+            json_encode(bindCounts) . "|" .
+            this->irCacheKey
+        );
+    }
+
+    /**
+     * Eager loads the relations set with setWith() in a resultset
+     */
+    protected function loadWith(var resultset) -> void
+    {
+        var manager;
+
+        let manager = this->manager;
+
+        if unlikely !(manager instanceof Manager) {
+            throw new Exception(
+                "Eager loading requires the models manager to be an instance of Phalcon\\Mvc\\Model\\Manager"
+            );
+        }
+
+        manager->eagerLoad(resultset, this->with);
+    }
+
     /**
      * Gets the read connection from the model if there is no transaction set
      * inside the query object
@@ -136,6 +136,13 @@ class Builder implements BuilderInterface, InjectionAwareInterface
      */
     protected sharedLock = false;
 
+    /**
+     * Relations to eager load in the resultset
+     *
+     * @var array
+     */
+    protected with = [];
+
     /**
      * Phalcon\Mvc\Model\Query\Builder constructor
      *
@@ -147,7 +154,7 @@ class Builder implements BuilderInterface, InjectionAwareInterface
         var conditions, columns, groupClause, havingClause, limitClause,
             forUpdate, sharedLock, orderClause, offsetClause, joinsClause,
             singleConditionArray, limit, offset, fromClause, singleCondition,
-            singleParams, singleTypes, distinct, bind, bindTypes;
+            singleParams, singleTypes, distinct, bind, bindTypes, with;
         array mergedConditions, mergedParams, mergedTypes;
 
         if typeof params == "array" {
@@ -296,6 +303,13 @@ class Builder implements BuilderInterface, InjectionAwareInterface
             if fetch sharedLock, params["shared_lock"] {
                 let this->sharedLock = sharedLock;
             }
+
+            /**
+             * Assign the relations to eager load
+             */
+            if fetch with, params["with"] {
+                this->with(with);
+            }
         } else {
             if typeof params == "string" && params !== "" {
                 let this->conditions = params;
@@ -1059,6 +1073,10 @@ class Builder implements BuilderInterface, InjectionAwareInterface
             query->setSharedLock(this->sharedLock);
         }
 
+        if count(this->with) {
+            query->setWith(this->with);
+        }
+
         return query;
     }
 
@@ -1072,6 +1090,14 @@ class Builder implements BuilderInterface, InjectionAwareInterface
         return this->conditions;
     }
 
+    /**
+     * Returns the relations to eager load
+     */
+    public function getWith() -> array
+    {
+        return this->with;
+    }
+
     /**
      * Sets a GROUP BY clause
      *
@@ -1558,6 +1584,37 @@ class Builder implements BuilderInterface, InjectionAwareInterface
         return this;
     }
 
+    /**
+     * Sets the relations to load for every record of the resultset with one
+     * query per relation, instead of one query per record. Nested relations
+     * are separated by dots
+     *
+     *```php
+     * $builder->with(
+     *     [
+     *         "robotsParts",
+     *         "robotsParts.parts",
+     *     ]
+     * );
+     *```
+     *
+     * @param array|string relations
+     */
+    public function with(var relations) -> <BuilderInterface>
+    {
+        if typeof relations == "string" {
+            let relations = [relations];
+        }
+
+        if unlikely typeof relations != "array" {
+            throw new Exception("Relations to eager load must be an array or a string");
+        }
+
+        let this->with = array_merge(this->with, relations);
+
+        return this;
+    }
+
     /**
      * Appends a BETWEEN condition
      */
@@ -16,6 +16,7 @@ use Countable;
 use Iterator;
 use JsonSerializable;
 use Phalcon\Db\Enum;
+use Phalcon\Db\Result\Pdo as ResultPdo;
 use Phalcon\Messages\MessageInterface;
 use Phalcon\Mvc\Model;
 use Phalcon\Mvc\ModelInterface;
@@ -119,6 +120,13 @@ abstract class Resultset
      */
     protected rows = null;
 
+    /**
+     * Whether the rows are read forward only from an unbuffered cursor
+     *
+     * @var bool
+     */
+    protected streaming = false;
+
     /**
      * Phalcon\Db\ResultInterface or false for empty resultset
      *
@@ -163,6 +171,16 @@ abstract class Resultset
          */
         result->setFetchMode(Enum::FETCH_ASSOC);
 
+        /**
+         * Unbuffered results are streamed: the rows are never kept in memory
+         * and the number of rows is only known once all of them are read
+         */
+        if result instanceof ResultPdo && result->isUnbuffered() {
+            let this->streaming = true;
+
+            return;
+        }
+
         /**
          * Update the row-count
          */
@@ -197,7 +215,66 @@ abstract class Resultset
     }
 
     /**
-     * Counts how many rows are in the resultset
+     * Iterates the resultset passing the records to the callback in chunks of
+     * the given size. Returning false from the callback stops the iteration.
+     * Combined with streaming, the memory used does not depend on the number
+     * of rows
+     *
+     *```php
+     * $robots = Robots::find(
+     *     [
+     *         "stream" => true,
+     *     ]
+     * );
+     *
+     * $robots->chunk(
+     *     1000,
+     *     function (array $robots) {
+     *         foreach ($robots as $robot) {
+     *             fputcsv($file, $robot->toArray());
+     *         }
+     *     }
+     * );
+     *```
+     */
+    public function chunk(int size, callable callback) -> bool
+    {
+        var records;
+
+        if unlikely size < 1 {
+            throw new Exception("The size of the chunks must be greater than zero");
+        }
+
+        let records = [];
+
+        this->rewind();
+
+        while this->valid() {
+            let records[] = this->{"current"}();
+
+            if count(records) == size {
+                if call_user_func(callback, records) === false {
+                    return false;
+                }
+
+                let records = [];
+            }
+
+            this->next();
+        }
+
+        if count(records) {
+            if call_user_func(callback, records) === false {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    /**
+     * Counts how many rows are in the resultset. Streaming resultsets only
+     * know the number of rows read so far
      */
     final public function count() -> int
     {
@@ -362,7 +439,7 @@ abstract class Resultset
      */
     public function getFirst() -> var | null
     {
-        if this->count == 0 {
+        if this->count == 0 && !this->streaming {
             return null;
         }
 
@@ -386,6 +463,12 @@ abstract class Resultset
     {
         var count;
 
+        if unlikely this->streaming {
+            throw new Exception(
+                "The last row of a streaming resultset is not available"
+            );
+        }
+
         let count = this->count;
 
         if count == 0 {
@@ -421,6 +504,15 @@ abstract class Resultset
         return this->isFresh;
     }
 
+    /**
+     * Checks whether the rows are streamed forward only from an unbuffered
+     * cursor
+     */
+    public function isStreaming() -> bool
+    {
+        return this->streaming;
+    }
+
     /**
      * Returns serialised model objects as array for json_encode.
      * Calls jsonSerialize on each object if present
@@ -538,6 +630,12 @@ abstract class Resultset
     {
         var result, row;
 
+        if this->streaming {
+            this->seekStreaming(position);
+
+            return;
+        }
+
         if this->pointer != position || this->row === null {
             if typeof this->rows == "array" {
                 /**
@@ -695,6 +793,50 @@ abstract class Resultset
      */
     public function valid() -> bool
     {
+        if this->streaming {
+            if this->row === null {
+                this->seekStreaming(this->pointer);
+            }
+
+            return typeof this->row == "array";
+        }
+
         return this->pointer < this->count;
     }
+
+    /**
+     * Moves the cursor of a streaming resultset forward to a position. The
+     * rows already read are not kept, so going back is not possible
+     */
+    protected function seekStreaming(int position) -> void
+    {
+        var result;
+
+        if unlikely position < this->pointer {
+            throw new Exception(
+                "Streaming resultsets can only be traversed forward"
+            );
+        }
+
+        let result = this->result;
+
+        if this->row === null {
+            let this->row = result->$fetch();
+
+            if typeof this->row == "array" {
+                let this->count++;
+            }
+        }
+
+        while this->pointer < position && typeof this->row == "array" {
+            let this->row       = result->$fetch(),
+                this->activeRow = null;
+
+            let this->pointer++;
+
+            if typeof this->row == "array" {
+                let this->count++;
+            }
+        }
+    }
 }
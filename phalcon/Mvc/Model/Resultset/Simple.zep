@@ -43,6 +43,13 @@ class Simple extends Resultset
      */
     protected keepSnapshots = false;
 
+    /**
+     * Eager loaded relations attached to every hydrated record
+     *
+     * @var array
+     */
+    protected related = [];
+
     /**
      * Phalcon\Mvc\Model\Resultset\Simple constructor
      *
@@ -75,7 +82,8 @@ class Simple extends Resultset
      */
     final public function current() -> <ModelInterface> | null
     {
-        var row, hydrateMode, columnMap, activeRow, modelName;
+        var row, hydrateMode, columnMap, activeRow, modelName, alias, eager,
+            key, rows, related;
 
         let activeRow = this->activeRow;
 
@@ -140,6 +148,25 @@ class Simple extends Resultset
                     );
                 }
 
+                /**
+                 * Attach the eager loaded relations
+                 */
+                for alias, eager in this->related {
+                    let key = activeRow->readAttribute(eager["field"]);
+
+                    if typeof key == "null" || !fetch rows, eager["rows"][key] {
+                        let rows = [];
+                    }
+
+                    let related = eager["resultset"]->withRows(rows);
+
+                    if eager["single"] {
+                        let related = related->getFirst();
+                    }
+
+                    activeRow->setRelated(alias, related);
+                }
+
                 break;
 
             default:
@@ -160,6 +187,32 @@ class Simple extends Resultset
         return activeRow;
     }
 
+    /**
+     * Attaches eager loaded records of a relation to every record hydrated by
+     * the resultset. The related rows are grouped by the value of the field
+     * of this resultset's model, and are hydrated through the resultset
+     * passed.
+     *
+     * @param string alias
+     * @param string field
+     * @param Simple resultset
+     * @param array  rows
+     * @param bool   single
+     */
+    public function setRelated(string! alias, string! field, <Simple> resultset, array! rows, bool single = false) -> <Simple>
+    {
+        let this->related[strtolower(alias)] = [
+            "field":     field,
+            "resultset": resultset,
+            "rows":      rows,
+            "single":    single
+        ];
+
+        let this->activeRow = null;
+
+        return this;
+    }
+
     /**
      * Returns a complete resultset as an array, if the resultset has a big
      * number of rows it could consume more memory than currently it does.
@@ -171,6 +224,12 @@ class Simple extends Resultset
         var result, records, record, renamedKey, key, value, columnMap;
         array renamedRecords, renamed;
 
+        if unlikely this->streaming {
+            throw new Exception(
+                "Streaming resultsets can not be converted to arrays, iterate them or use chunk() instead"
+            );
+        }
+
         /**
          * If _rows is not present, fetchAll from database
          * and keep them in memory for further operations
@@ -284,6 +343,25 @@ class Simple extends Resultset
         return serialize(data);
     }
 
+    /**
+     * Returns a new resultset with the same model, column map and hydration
+     * settings containing the rows passed
+     */
+    public function withRows(array! rows) -> <Simple>
+    {
+        var resultset;
+
+        let resultset = clone this;
+
+        let resultset->rows      = rows,
+            resultset->count     = count(rows),
+            resultset->pointer   = 0,
+            resultset->row       = null,
+            resultset->activeRow = null;
+
+        return resultset;
+    }
+
     /**
      * Unserializing a resultset will allow to only works on the rows present in
      * the saved state
@@ -63,6 +63,16 @@ class Router extends AbstractInjectionAware implements RouterInterface, EventsAw
      */
     protected controller = null;
 
+    /**
+     * @var bool
+     */
+    protected compiledMatching = false;
+
+    /**
+     * @var array|null
+     */
+    protected compiledRoutes = null;
+
     /**
      * @var string|null
      */
@@ -459,6 +469,8 @@ class Router extends AbstractInjectionAware implements RouterInterface, EventsAw
                 throw new Exception("Invalid route position");
         }
 
+        let this->compiledRoutes = null;
+
         return this;
     }
 
@@ -467,7 +479,123 @@ class Router extends AbstractInjectionAware implements RouterInterface, EventsAw
      */
     public function clear() -> void
     {
-        let this->routes = [];
+        let this->routes = [],
+            this->compiledRoutes = null;
+    }
+
+    /**
+     * Compiles the routes into a matching automaton used by handle() when
+     * compiled matching is enabled.
+     *
+     * Static routes are indexed by their full path. Regular expression routes
+     * are grouped by HTTP method and by the first literal segment of their
+     * pattern, and merged into combined alternations which use `(*MARK)` to
+     * report the route that matched. Routes that cannot be merged safely
+     * (custom flags, alternations, named groups or back references) are
+     * always returned as candidates.
+     *
+     *```php
+     * $router->setCompiledMatching(true);
+     *
+     * // Rebuild the automaton after changing routes already attached
+     * $router->compile();
+     *```
+     */
+    public function compile() -> array
+    {
+        var key, route, pattern, methods, method, segment, body, methodBuckets,
+            bucket, node, chunk, chunks, parts, bodies, chunkKeys;
+        array compiled, buckets;
+
+        let compiled = [
+                "methods": [],
+                "static":  [],
+                "dynamic": []
+            ],
+            buckets = [];
+
+        /**
+         * Routes are traversed in reversed order, the same as in handle()
+         */
+        for key, route in array_reverse(this->routes, true) {
+            let pattern = route->getCompiledPattern(),
+                methods = route->getHttpMethods();
+
+            if typeof methods == "string" {
+                let methods = [methods];
+            } elseif typeof methods != "array" {
+                let methods = ["*"];
+            }
+
+            for method in methods {
+                if method !== "*" {
+                    let compiled["methods"][method] = method;
+                }
+
+                /**
+                 * Patterns without '^' are compared as plain strings
+                 */
+                if !memstr(pattern, "^") {
+                    let compiled["static"][method][pattern][] = key;
+
+                    continue;
+                }
+
+                let body = this->getCompiledBody(pattern);
+
+                if body === null {
+                    let buckets[method][""]["raw"][] = key;
+
+                    continue;
+                }
+
+                let segment = this->getCompiledSegment(body);
+
+                let buckets[method][segment]["bodies"][key] = body;
+            }
+        }
+
+        for method, methodBuckets in buckets {
+            for segment, bucket in methodBuckets {
+                let node = [
+                    "raw":    [],
+                    "chunks": []
+                ];
+
+                if fetch parts, bucket["raw"] {
+                    let node["raw"] = parts;
+                }
+
+                if fetch bodies, bucket["bodies"] {
+                    /**
+                     * Keep each combined expression well below the PCRE
+                     * pattern size limits
+                     */
+                    let chunks = array_chunk(bodies, 50, true);
+
+                    for chunk in chunks {
+                        let parts = [],
+                            chunkKeys = [];
+
+                        for key, body in chunk {
+                            let parts[] = "(?:" . body . ")(*MARK:" . key . ")",
+                                chunkKeys[] = key;
+                        }
+
+                        let node["chunks"][] = [
+                            "regex":  "#^(?:" . implode("|", parts) . ")$#u",
+                            "routes": chunkKeys
+                        ];
+                    }
+                }
+
+                let compiled["dynamic"][method][segment] = node;
+            }
+        }
+
+        let this->compiledRoutes = compiled;
+
+        return compiled;
     }
 
     /**
@@ -619,7 +747,7 @@ class Router extends AbstractInjectionAware implements RouterInterface, EventsAw
             notFoundPaths, vnamespace, module,  controller, action, paramsStr,
             strParams, route, methods, container, hostname, regexHostName,
             matched, pattern, handledUri, beforeMatch, paths, converters, part,
-            position, matchPosition, converter, eventsManager;
+            position, matchPosition, converter, eventsManager, routes;
 
         let uri = parse_url(uri, PHP_URL_PATH);
 
@@ -651,10 +779,20 @@ class Router extends AbstractInjectionAware implements RouterInterface, EventsAw
             eventsManager->fire("router:beforeCheckRoutes", this);
         }
 
+        /**
+         * When compiled matching is enabled, only the routes that can match
+         * the URI are checked
+         */
+        if this->compiledMatching {
+            let routes = this->getCompiledCandidates(handledUri);
+        } else {
+            let routes = this->routes;
+        }
+
         /**
          * Routes are traversed in reversed order
          */
-        for route in reverse this->routes {
+        for route in reverse routes {
             let params = [],
                 matches = null;
 
@@ -980,6 +1118,14 @@ class Router extends AbstractInjectionAware implements RouterInterface, EventsAw
         }
     }
 
+    /**
+     * Returns whether the compiled route matcher is used by handle()
+     */
+    public function isCompiledMatching() -> bool
+    {
+        return this->compiledMatching;
+    }
+
     /**
      * Returns whether controller name should not be mangled
      */
@@ -1035,7 +1181,8 @@ class Router extends AbstractInjectionAware implements RouterInterface, EventsAw
 
         let routes = this->routes;
 
-        let this->routes = array_merge(routes, groupRoutes);
+        let this->routes = array_merge(routes, groupRoutes),
+            this->compiledRoutes = null;
 
         return this;
     }
@@ -1075,6 +1222,26 @@ class Router extends AbstractInjectionAware implements RouterInterface, EventsAw
         return this;
     }
 
+    /**
+     * Enables or disables the compiled route matcher. When enabled, handle()
+     * uses the automaton built by compile() to select the candidate routes
+     * instead of checking every route. The automaton is built on the first
+     * handle() call and rebuilt whenever routes are attached.
+     *
+     * Only candidate routes fire the `router:beforeCheckRoute` and
+     * `router:notMatchedRoute` events.
+     *
+     * @param bool compiledMatching
+     *
+     * @return RouterInterface
+     */
+    public function setCompiledMatching(bool! compiledMatching) -> <RouterInterface>
+    {
+        let this->compiledMatching = compiledMatching;
+
+        return this;
+    }
+
     /**
      * Sets the default action name
      *
@@ -1216,4 +1383,189 @@ class Router extends AbstractInjectionAware implements RouterInterface, EventsAw
     {
         return this->wasMatched;
     }
+
+    /**
+     * Returns the routes that can match the URI, in the order they were
+     * added, using the compiled automaton
+     */
+    protected function getCompiledCandidates(string! uri) -> array
+    {
+        var compiled, container, request, methods, method, position, segment,
+            indexes, index, node, candidates, routes;
+
+        if this->compiledRoutes === null {
+            this->compile();
+        }
+
+        let compiled = this->compiledRoutes;
+
+        /**
+         * Routes without HTTP method constraints are stored under '*'
+         */
+        let methods = ["*"];
+
+        if count(compiled["methods"]) > 0 {
+            let container = <DiInterface> this->container;
+
+            if typeof container == "object" {
+                let request = <RequestInterface> container->getShared("request"),
+                    methods[] = request->getMethod();
+            } else {
+                /**
+                 * Let handle() report the missing service
+                 */
+                let methods = array_merge(
+                    methods,
+                    array_values(compiled["methods"])
+                );
+            }
+        }
+
+        /**
+         * The first segment of the URI: "/api/users/1" => "api"
+         */
+        let position = strpos(uri, "/", 1);
+
+        if position === false {
+            let segment = (string) substr(uri, 1);
+        } else {
+            let segment = (string) substr(uri, 1, position - 1);
+        }
+
+        let candidates = [];
+
+        for method in methods {
+            if fetch indexes, compiled["static"][method][uri] {
+                for index in indexes {
+                    let candidates[index] = true;
+                }
+            }
+
+            if segment !== "" && fetch node, compiled["dynamic"][method][segment] {
+                for index in this->matchCompiledNode(node, uri) {
+                    let candidates[index] = true;
+                }
+            }
+
+            if fetch node, compiled["dynamic"][method][""] {
+                for index in this->matchCompiledNode(node, uri) {
+                    let candidates[index] = true;
+                }
+            }
+        }
+
+        ksort(candidates);
+
+        let routes = [];
+
+        for index in array_keys(candidates) {
+            let routes[] = this->routes[index];
+        }
+
+        return routes;
+    }
+
+    /**
+     * Returns the regular expression between the anchors of a pattern
+     * produced by Route::compilePattern(), or null if the pattern cannot be
+     * merged with others
+     */
+    protected function getCompiledBody(string! pattern) -> string | null
+    {
+        string body;
+
+        if !starts_with(pattern, "#^") || substr(pattern, -3) !== "$#u" {
+            return null;
+        }
+
+        let body = (string) substr(pattern, 2, -3);
+
+        /**
+         * Alternations, inline options, named groups and back references
+         * change meaning when the expression is merged
+         */
+        if memstr(body, "|") || memstr(body, "(?") || preg_match("/\\\\[0-9gk]/", body) {
+            return null;
+        }
+
+        return body;
+    }
+
+    /**
+     * Returns the first literal segment of a regular expression, or an empty
+     * string if the expression does not start with a complete literal segment
+     */
+    protected function getCompiledSegment(string! body) -> string
+    {
+        char ch;
+        var position;
+        string literal = "";
+
+        for ch in body {
+            if ch == '*' || ch == '+' || ch == '?' || ch == '{' {
+                /**
+                 * A quantifier makes the previous character optional
+                 */
+                let literal = (string) substr(literal, 0, -1);
+
+                break;
+            }
+
+            if ch == '\\' || ch == '.' || ch == '[' || ch == '(' || ch == ')' || ch == '^' || ch == '$' {
+                break;
+            }
+
+            let literal .= ch;
+        }
+
+        if !starts_with(literal, "/") {
+            return "";
+        }
+
+        let position = strpos(literal, "/", 1);
+
+        if position === false {
+            return "";
+        }
+
+        return (string) substr(literal, 1, position - 1);
+    }
+
+    /**
+     * Returns the routes of a compiled node that can match the URI
+     */
+    protected function matchCompiledNode(array! node, string! uri) -> array
+    {
+        var indexes, chunk, matches, mark, index;
+        bool found;
+
+        let indexes = node["raw"];
+
+        for chunk in node["chunks"] {
+            let matches = null;
+
+            if !preg_match(chunk["regex"], uri, matches) {
+                continue;
+            }
+
+            /**
+             * Routes before the marked one are known not to match, routes
+             * after it are checked again by handle() if it is rejected
+             */
+            let mark = matches["MARK"],
+                found = false;
+
+            for index in chunk["routes"] {
+                if index == mark {
+                    let found = true;
+                }
+
+                if found {
+                    let indexes[] = index;
+                }
+            }
+        }
+
+        return indexes;
+    }
 }
@@ -11,9 +11,14 @@
 namespace Phalcon\Mvc\View\Engine\Volt;
 
 use Closure;
+use FilesystemIterator;
 use Phalcon\Di\DiInterface;
+use Phalcon\Helper\Fs;
 use Phalcon\Mvc\ViewBaseInterface;
 use Phalcon\Di\InjectionAwareInterface;
+use RecursiveDirectoryIterator;
+use RecursiveIteratorIterator;
+use Throwable;
 
 /**
  * This class reads and compiles Volt templates into PHP plain code
@@ -280,7 +285,7 @@ class Compiler implements InjectionAwareInterface
      */
     public function compile(string! templatePath, bool extendsMode = false)
     {
-        var blocksCode, compilation, compileAlways, compiledExtension,
+        var compilation, compileAlways, compiledExtension,
             compiledPath, compiledSeparator, compiledTemplatePath, options,
             prefix, stat, templateSepPath;
 
@@ -439,55 +444,19 @@ class Compiler implements InjectionAwareInterface
         }
 
         /**
-         * Compile always must be used only in the development stage
+         * Compile always must be used only in the development stage. Stat
+         * compares modification timestamps to check if the file needs to be
+         * recompiled
          */
-        if !file_exists(compiledTemplatePath) || compileAlways {
-            /**
-             * The file needs to be compiled because it either doesn't exist or
-             * needs to compiled every time
-             */
-            let compilation = this->compileFile(
+        if compileAlways || !file_exists(compiledTemplatePath) || (stat === true && compare_mtime(templatePath, compiledTemplatePath)) {
+            let compilation = this->compileFileLocked(
                 templatePath,
                 compiledTemplatePath,
-                extendsMode
+                extendsMode,
+                compileAlways
             );
-        } else {
-            if stat === true {
-                /**
-                 * Compare modification timestamps to check if the file
-                 * needs to be recompiled
-                 */
-                if compare_mtime(templatePath, compiledTemplatePath) {
-                    let compilation = this->compileFile(
-                        templatePath,
-                        compiledTemplatePath,
-                        extendsMode
-                    );
-                } else {
-                    if extendsMode {
-                        /**
-                         * In extends mode we read the file that must
-                         * contains a serialized array of blocks
-                         */
-                        let blocksCode = file_get_contents(compiledTemplatePath);
-
-                        if unlikely blocksCode === false {
-                            throw new Exception(
-                                "Extends compilation file " . compiledTemplatePath . " could not be opened"
-                            );
-                        }
-
-                        /**
-                         * Unserialize the array blocks code
-                         */
-                        if blocksCode {
-                            let compilation = unserialize(blocksCode);
-                        } else {
-                            let compilation = [];
-                        }
-                    }
-                }
-            }
+        } elseif extendsMode {
+            let compilation = this->readCompiledBlocks(compiledTemplatePath);
         }
 
         let this->compiledTemplatePath = compiledTemplatePath;
@@ -573,6 +542,72 @@ class Compiler implements InjectionAwareInterface
         return "<?php case " . this->expression(expr) . ": ?>";
     }
 
+    /**
+     * Compiles every template found in a directory and its subdirectories,
+     * returning the compiled path of each template. Useful to precompile the
+     * views during a deploy, i.e. from a CLI task, and run with the "stat"
+     * option disabled
+     *
+     *```php
+     * $compiler->setOptions(
+     *     [
+     *         "path" => "../app/compiled-templates/",
+     *         "stat" => false,
+     *     ]
+     * );
+     *
+     * $compiled = $compiler->compileDirectory("../app/views/");
+     *```
+     *
+     * @throws \Phalcon\Mvc\View\Engine\Volt\Exception
+     */
+    public function compileDirectory(string! directory, string! extension = ".volt") -> array
+    {
+        var options, iterator, file, templatePath, e;
+        array compiled;
+
+        if unlikely !is_dir(directory) {
+            throw new Exception("Directory " . directory . " does not exist");
+        }
+
+        let compiled = [],
+            options = this->options;
+
+        /**
+         * Templates are always compiled, existing compilations may be stale
+         */
+        let this->options["always"] = true;
+
+        try {
+            let iterator = new RecursiveIteratorIterator(
+                new RecursiveDirectoryIterator(
+                    directory,
+                    FilesystemIterator::SKIP_DOTS
+                )
+            );
+
+            for file in iterator {
+                let templatePath = file->getPathname();
+
+                if !file->isFile() || !ends_with(templatePath, extension) {
+                    continue;
+                }
+
+                this->compile(templatePath);
+
+                let compiled[templatePath] = this->compiledTemplatePath;
+            }
+        } catch Throwable, e {
+            let this->options = options;
+
+            throw e;
+        }
+
+        let this->options = options;
+
+        return compiled;
+    }
+
     /**
      * Compiles a "do" statement returning PHP code
      *
@@ -729,9 +764,11 @@ class Compiler implements InjectionAwareInterface
 
         /**
          * Always use file_put_contents to write files instead of write the file
-         * directly, this respect the open_basedir directive
+         * directly, this respect the open_basedir directive. The compilation
+         * is written to a temporary file and renamed, so concurrent requests
+         * never include a half written template
          */
-        if unlikely file_put_contents(compiledPath, finalCompilation) === false {
+        if unlikely !Fs::write(compiledPath, finalCompilation) {
             throw new Exception("Volt directory can't be written");
         }
 
@@ -2370,6 +2407,70 @@ class Compiler implements InjectionAwareInterface
         return compilation;
     }
 
+    /**
+     * Compiles a template holding a lock per compiled template, so only one
+     * process compiles it while the others wait and reuse the compilation.
+     * The lock file is removed once the compiled template is in place
+     */
+    protected function compileFileLocked(
+        string! path,
+        string! compiledPath,
+        bool extendsMode = false,
+        bool compileAlways = false
+    ) {
+        var handler, compilation, e, lockPath;
+
+        let lockPath = compiledPath . ".lock",
+            handler  = fopen(lockPath, "c");
+
+        if handler === false {
+            return this->compileFile(path, compiledPath, extendsMode);
+        }
+
+        flock(handler, LOCK_EX);
+
+        try {
+            /**
+             * Another process compiled the template while waiting for the lock
+             */
+            if !compileAlways && file_exists(compiledPath) && !compare_mtime(path, compiledPath) {
+                if extendsMode {
+                    let compilation = this->readCompiledBlocks(compiledPath);
+                } else {
+                    let compilation = null;
+                }
+            } else {
+                let compilation = this->compileFile(
+                    path,
+                    compiledPath,
+                    extendsMode
+                );
+            }
+        } catch Throwable, e {
+            if file_exists(lockPath) {
+                unlink(lockPath);
+            }
+
+            flock(handler, LOCK_UN);
+            fclose(handler);
+
+            throw e;
+        }
+
+        /**
+         * Processes still waiting hold the unlinked file and find the
+         * compiled template once they get the lock
+         */
+        if file_exists(lockPath) {
+            unlink(lockPath);
+        }
+
+        flock(handler, LOCK_UN);
+        fclose(handler);
+
+        return compilation;
+    }
+
     /**
      * Gets the final path with VIEW
      */
@@ -2399,6 +2500,32 @@ class Compiler implements InjectionAwareInterface
         return path;
     }
 
+    /**
+     * Reads the serialized array of blocks of a template compiled in extends
+     * mode
+     */
+    protected function readCompiledBlocks(string! compiledPath)
+    {
+        var blocksCode;
+
+        let blocksCode = file_get_contents(compiledPath);
+
+        if unlikely blocksCode === false {
+            throw new Exception(
+                "Extends compilation file " . compiledPath . " could not be opened"
+            );
+        }
+
+        /**
+         * Unserialize the array blocks code
+         */
+        if blocksCode {
+            return unserialize(blocksCode);
+        }
+
+        return [];
+    }
+
     /**
      * Resolves filter intermediate code into PHP function calls
      */
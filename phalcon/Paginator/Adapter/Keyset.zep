@@ -0,0 +1,377 @@
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+namespace Phalcon\Paginator\Adapter;
+
+use Phalcon\Helper\Base64;
+use Phalcon\Mvc\Model\Query\Builder;
+use Phalcon\Paginator\Exception;
+use Phalcon\Paginator\RepositoryInterface;
+use Psr\SimpleCache\CacheInterface;
+
+/**
+ * Phalcon\Paginator\Adapter\Keyset
+ *
+ * Pagination by an ordered unique key (cursor pagination). Instead of an
+ * offset, each page continues after the key values of the last row of the
+ * previous one, so any page costs the same as the first. The repository
+ * returns opaque cursors to the next and previous pages.
+ *
+ * The total of items is only counted when a cache is passed, and kept in it
+ * for the "lifetime" option, or disabled with "count" set to false.
+ *
+ * ```php
+ * use Phalcon\Paginator\Adapter\Keyset;
+ *
+ * $builder = $this->modelsManager->createBuilder()
+ *                 ->from(Invoices::class);
+ *
+ * $paginator = new Keyset(
+ *     [
+ *         "builder" => $builder,
+ *         "keys"    => ["inv_created_at", "inv_id"],
+ *         "limit"   => 20,
+ *         "cursor"  => $this->request->getQuery("cursor"),
+ *         "cache"   => $this->modelsCache,
+ *     ]
+ * );
+ *
+ * $page = $paginator->paginate();
+ *
+ * echo $page->getNextCursor();
+ *```
+ */
+class Keyset extends AbstractAdapter
+{
+    /**
+     * Paginator's data
+     *
+     * @var Builder
+     */
+    protected builder;
+
+    /**
+     * @var CacheInterface|null
+     */
+    protected cache = null;
+
+    /**
+     * @var string|null
+     */
+    protected cursor = null;
+
+    /**
+     * @var bool
+     */
+    protected descending = false;
+
+    /**
+     * Columns of the ordered unique key
+     *
+     * @var array
+     */
+    protected keys = [];
+
+    /**
+     * Phalcon\Paginator\Adapter\Keyset
+     *
+     * @param array config = [
+     *     'limit'    => 10,
+     *     'builder'  => null,
+     *     'keys'     => [],
+     *     'order'    => 'ASC',
+     *     'cursor'   => null,
+     *     'cache'    => null,
+     *     'cacheKey' => null,
+     *     'lifetime' => null,
+     *     'count'    => true
+     * ]
+     */
+    public function __construct(array config)
+    {
+        var builder, cache, cursor, keys, order;
+
+        if unlikely !isset config["limit"] {
+            throw new Exception("Parameter 'limit' is required");
+        }
+
+        if unlikely !fetch builder, config["builder"] {
+            throw new Exception("Parameter 'builder' is required");
+        }
+
+        if unlikely !(builder instanceof Builder) {
+            throw new Exception(
+                "Parameter 'builder' must be an instance " .
+                "of Phalcon\\Mvc\\Model\\Query\\Builder"
+            );
+        }
+
+        if !fetch keys, config["keys"] {
+            let keys = [];
+        }
+
+        if unlikely typeof keys != "array" || empty keys {
+            throw new Exception("Parameter 'keys' is required");
+        }
+
+        if fetch cache, config["cache"] {
+            if unlikely !(cache instanceof CacheInterface) {
+                throw new Exception(
+                    "Parameter 'cache' must be an instance " .
+                    "of Psr\\SimpleCache\\CacheInterface"
+                );
+            }
+
+            let this->cache = cache;
+        }
+
+        if fetch cursor, config["cursor"] {
+            let this->cursor = cursor;
+        }
+
+        if fetch order, config["order"] {
+            let this->descending = strtoupper(order) === "DESC";
+        }
+
+        let this->builder = builder,
+            this->keys    = array_values(keys);
+
+        parent::__construct(config);
+    }
+
+    /**
+     * Get query builder object
+     */
+    public function getQueryBuilder() -> <Builder>
+    {
+        return this->builder;
+    }
+
+    /**
+     * Returns the rows of the page and the cursors to the next and previous
+     * ones
+     */
+    public function paginate() -> <RepositoryInterface>
+    {
+        var builder, direction, limit, nextCursor = null, previousCursor = null,
+            row, rows, values = null;
+        bool hasMore, reverse;
+        string operator, order;
+
+        let builder   = clone this->builder,
+            limit     = this->limitRows,
+            direction = "n";
+
+        if this->cursor {
+            let values    = this->decodeCursor(this->cursor),
+                direction = values[0],
+                values    = values[1];
+        }
+
+        /**
+         * The previous page is read backwards from the first row
+         */
+        let reverse = direction === "p";
+
+        if this->descending !== reverse {
+            let operator = "<",
+                order    = "DESC";
+        } else {
+            let operator = ">",
+                order    = "ASC";
+        }
+
+        if values !== null {
+            this->addKeysCondition(builder, operator, values);
+        }
+
+        builder->orderBy(
+            implode(" " . order . ", ", this->keys) . " " . order
+        );
+
+        /**
+         * One more row tells if there is another page
+         */
+        builder->limit(limit + 1);
+
+        let rows = [];
+
+        for row in builder->getQuery()->execute() {
+            let rows[] = row;
+        }
+
+        let hasMore = count(rows) > limit;
+
+        if hasMore {
+            let rows = array_slice(rows, 0, limit);
+        }
+
+        if reverse {
+            let rows = array_reverse(rows);
+        }
+
+        if count(rows) {
+            if reverse {
+                let nextCursor = this->encodeCursor("n", rows[count(rows) - 1]);
+
+                if hasMore {
+                    let previousCursor = this->encodeCursor("p", rows[0]);
+                }
+            } else {
+                if hasMore {
+                    let nextCursor = this->encodeCursor("n", rows[count(rows) - 1]);
+                }
+
+                if values !== null {
+                    let previousCursor = this->encodeCursor("p", rows[0]);
+                }
+            }
+        }
+
+        return this->getRepository(
+            [
+                RepositoryInterface::PROPERTY_ITEMS           : rows,
+                RepositoryInterface::PROPERTY_TOTAL_ITEMS     : this->getTotalItems(),
+                RepositoryInterface::PROPERTY_LIMIT           : this->limitRows,
+                RepositoryInterface::PROPERTY_NEXT_CURSOR     : nextCursor,
+                RepositoryInterface::PROPERTY_PREVIOUS_CURSOR : previousCursor
+            ]
+        );
+    }
+
+    /**
+     * Set query builder object
+     */
+    public function setQueryBuilder(<Builder> builder) -> <Keyset>
+    {
+        let this->builder = builder;
+
+        return this;
+    }
+
+    /**
+     * Adds the condition `(a, b) > (?, ?)` as
+     * `(a > ?) OR (a = ? AND b > ?)`, which every database understands
+     */
+    protected function addKeysCondition(<Builder> builder, string! operator, array values) -> void
+    {
+        var index, key, parts;
+        array bind, conditions, previous;
+
+        let bind       = [],
+            conditions = [],
+            previous   = [];
+
+        for index, key in this->keys {
+            if unlikely !array_key_exists(index, values) {
+                throw new Exception("The cursor is not valid");
+            }
+
+            let parts   = previous,
+                parts[] = key . " " . operator . " :keyset" . index . ":";
+
+            let conditions[]           = "(" . implode(" AND ", parts) . ")",
+                previous[]             = key . " = :keyset" . index . ":",
+                bind["keyset" . index] = values[index];
+        }
+
+        builder->andWhere(
+            "(" . implode(" OR ", conditions) . ")",
+            bind
+        );
+    }
+
+    /**
+     * Returns the direction and the key values of a cursor
+     */
+    protected function decodeCursor(string! cursor) -> array
+    {
+        var decoded;
+
+        let decoded = json_decode(Base64::decodeUrl(cursor), true);
+
+        if unlikely typeof decoded != "array" || !isset decoded[0] || !isset decoded[1] ||
+            (decoded[0] !== "n" && decoded[0] !== "p") || typeof decoded[1] != "array" {
+            throw new Exception("The cursor is not valid");
+        }
+
+        return decoded;
+    }
+
+    /**
+     * Returns the opaque cursor with the key values of a row
+     */
+    protected function encodeCursor(string! direction, var row) -> string
+    {
+        var key, property;
+        array values;
+
+        let values = [];
+
+        for key in this->keys {
+            /**
+             * "Invoices.inv_id" is read as "inv_id"
+             */
+            let property = key;
+
+            if memstr(key, ".") {
+                let property = substr(strrchr(key, "."), 1);
+            }
+
+            let values[] = row->{property};
+        }
+
+        return Base64::encodeUrl(
+            json_encode([direction, values])
+        );
+    }
+
+    /**
+     * Returns the total of items, read from the cache when passed
+     */
+    protected function getTotalItems() -> int
+    {
+        var builder, cacheKey, lifetime = null, row, total;
+
+        if this->cache === null || (isset this->config["count"] && !this->config["count"]) {
+            return 0;
+        }
+
+        if !fetch cacheKey, this->config["cacheKey"] {
+            let cacheKey = "keyset-" . sha1(
+                this->builder->getPhql() . serialize(this->builder->getBindParams())
+            );
+        }
+
+        let total = this->cache->get(cacheKey);
+
+        if total !== null {
+            return (int) total;
+        }
+
+        let builder = clone this->builder;
+
+        builder->columns("COUNT(*) [rowcount]");
+
+        /**
+         * Remove the 'ORDER BY' clause, PostgreSQL requires this
+         */
+        builder->orderBy(null);
+
+        let row   = builder->getQuery()->execute()->getFirst(),
+            total = row ? intval(row->rowcount) : 0;
+
+        fetch lifetime, this->config["lifetime"];
+
+        this->cache->set(cacheKey, total, lifetime);
+
+        return total;
+    }
+}
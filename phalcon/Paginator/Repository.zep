@@ -119,6 +119,22 @@ class Repository implements RepositoryInterface, JsonSerializable
         return this->getProperty(self::PROPERTY_PREVIOUS_PAGE, 0);
     }
 
+    /**
+     * Gets the cursor of the next page (keyset pagination)
+     */
+    public function getNextCursor() -> string | null
+    {
+        return this->getProperty(self::PROPERTY_NEXT_CURSOR);
+    }
+
+    /**
+     * Gets the cursor of the previous page (keyset pagination)
+     */
+    public function getPreviousCursor() -> string | null
+    {
+        return this->getProperty(self::PROPERTY_PREVIOUS_CURSOR);
+    }
+
     /**
      * {@inheritdoc}
      */
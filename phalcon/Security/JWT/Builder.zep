@@ -15,6 +15,7 @@ use Phalcon\Collection\CollectionInterface;
 use Phalcon\Helper\Base64;
 use Phalcon\Helper\Json;
 use Phalcon\Security\JWT\Exceptions\ValidatorException;
+use Phalcon\Security\JWT\Signer\AbstractOpenSsl;
 use Phalcon\Security\JWT\Signer\SignerInterface;
 use Phalcon\Security\JWT\Token\Enum;
 use Phalcon\Security\JWT\Token\Item;
@@ -374,6 +375,9 @@ class Builder
     }
 
     /**
+     * Sets the passphrase used to sign the token. For the OpenSSL signers
+     * this is the private key, as PEM contents or a "file://" path
+     *
      * @param string $passphrase
      *
      * @return Builder
@@ -381,7 +385,7 @@ class Builder
      */
     public function setPassphrase(string! passphrase) -> <Builder>
     {
-        if !preg_match(
+        if !(this->signer instanceof AbstractOpenSsl) && !preg_match(
             "/(?=^.{16,}$)((?=.*\d)|(?=.*\W+))(?![.\n])(?=.*[A-Z])(?=.*[a-z]).*$/",
             passphrase
         ) {
@@ -0,0 +1,159 @@
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+namespace Phalcon\Security\JWT\Signer;
+
+use Phalcon\Security\JWT\Exceptions\UnsupportedAlgorithmException;
+
+/**
+ * Class AbstractOpenSsl
+ *
+ * Base class for the signers using public key cryptography through
+ * ext-openssl. The passphrase is the private key (when signing) or the
+ * public key (when verifying), as PEM contents or a "file://" path
+ */
+abstract class AbstractOpenSsl extends AbstractSigner
+{
+    /**
+     * Keys already loaded, by their PEM contents or path
+     *
+     * @var array
+     */
+    private keys = [];
+
+    /**
+     * Sign a payload using the private key
+     *
+     * @param string $payload
+     * @param string $passphrase
+     *
+     * @return string
+     */
+    public function sign(string! payload, string! passphrase) -> string
+    {
+        var key, signature;
+
+        let key = this->getKey(passphrase, true);
+
+        if unlikely !openssl_sign(payload, signature, key, this->getOpenSslAlgorithm()) {
+            throw new UnsupportedAlgorithmException(
+                "The payload could not be signed: " . openssl_error_string()
+            );
+        }
+
+        return this->toSignature(signature);
+    }
+
+    /**
+     * Verify a passed source with a payload and the public key
+     *
+     * @param string $source
+     * @param string $payload
+     * @param string $passphrase
+     *
+     * @return bool
+     */
+    public function verify(string! source, string! payload, string! passphrase) -> bool
+    {
+        var key, signature;
+
+        let signature = this->fromSignature(source);
+
+        if signature === false {
+            return false;
+        }
+
+        let key = this->getKey(passphrase, false);
+
+        return 1 === openssl_verify(
+            payload,
+            signature,
+            key,
+            this->getOpenSslAlgorithm()
+        );
+    }
+
+    /**
+     * Returns the signature computed by openssl from the JWT one
+     *
+     * @param string $signature
+     *
+     * @return string|bool
+     */
+    protected function fromSignature(string! signature) -> string | bool
+    {
+        return signature;
+    }
+
+    /**
+     * Returns the OPENSSL_ALGO_* constant of the algorithm
+     *
+     * @return int
+     */
+    protected function getOpenSslAlgorithm() -> int
+    {
+        switch this->algorithm {
+            case "sha384":
+                return OPENSSL_ALGO_SHA384;
+
+            case "sha512":
+                return OPENSSL_ALGO_SHA512;
+        }
+
+        return OPENSSL_ALGO_SHA256;
+    }
+
+    /**
+     * Returns the JWT signature from the one computed by openssl
+     *
+     * @param string $signature
+     *
+     * @return string
+     */
+    protected function toSignature(string! signature) -> string
+    {
+        return signature;
+    }
+
+    /**
+     * Returns the key of a passphrase, loading it only once
+     *
+     * @param string $passphrase
+     * @param bool   $private
+     *
+     * @return mixed
+     */
+    private function getKey(string! passphrase, bool isPrivate)
+    {
+        var key;
+        string index;
+
+        let index = (isPrivate ? "private:" : "public:") . passphrase;
+
+        if fetch key, this->keys[index] {
+            return key;
+        }
+
+        if isPrivate {
+            let key = openssl_pkey_get_private(passphrase);
+        } else {
+            let key = openssl_pkey_get_public(passphrase);
+        }
+
+        if unlikely key === false {
+            throw new UnsupportedAlgorithmException(
+                "The key could not be read: " . openssl_error_string()
+            );
+        }
+
+        let this->keys[index] = key;
+
+        return key;
+    }
+}
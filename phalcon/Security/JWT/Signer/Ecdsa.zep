@@ -0,0 +1,148 @@
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+namespace Phalcon\Security\JWT\Signer;
+
+use Phalcon\Security\JWT\Exceptions\UnsupportedAlgorithmException;
+
+/**
+ * Class Ecdsa
+ *
+ * ECDSA signatures (ES256 with P-256, ES384 with P-384, ES512 with P-521).
+ * openssl uses DER encoded signatures, converted to and from the
+ * concatenated R and S values used by JWT
+ */
+class Ecdsa extends AbstractOpenSsl
+{
+    /**
+     * Length of R and S for each algorithm
+     *
+     * @var int
+     */
+    private partLength = 32;
+
+    /**
+     * Ecdsa constructor.
+     *
+     * @param string $algo
+     *
+     * @throws UnsupportedAlgorithmException
+     */
+    public function __construct(string! algo = "sha256")
+    {
+        array supported;
+
+        let supported = [
+            "sha512" : 66,
+            "sha384" : 48,
+            "sha256" : 32
+        ];
+
+        if !isset supported[algo] {
+            throw new UnsupportedAlgorithmException(
+                "Unsupported ECDSA algorithm"
+            );
+        };
+
+        let this->algorithm  = algo,
+            this->partLength = supported[algo];
+    }
+
+    /**
+     * Return the value that is used for the "alg" header
+     *
+     * @return string
+     */
+    public function getAlgHeader() -> string
+    {
+        return "ES" . str_replace("sha", "", this->algorithm);
+    }
+
+    /**
+     * Converts the concatenated R and S values to a DER sequence
+     *
+     * @param string $signature
+     *
+     * @return string|bool
+     */
+    protected function fromSignature(string! signature) -> string | bool
+    {
+        string sequence;
+        int length;
+
+        if strlen(signature) !== 2 * this->partLength {
+            return false;
+        }
+
+        let sequence = this->toDerInteger(substr(signature, 0, this->partLength)) .
+                       this->toDerInteger(substr(signature, this->partLength)),
+            length   = strlen(sequence);
+
+        if length > 127 {
+            return chr(0x30) . chr(0x81) . chr(length) . sequence;
+        }
+
+        return chr(0x30) . chr(length) . sequence;
+    }
+
+    /**
+     * Converts a DER sequence to the concatenated R and S values
+     *
+     * @param string $signature
+     *
+     * @return string
+     */
+    protected function toSignature(string! signature) -> string
+    {
+        int offset, length;
+        string r, s;
+
+        /**
+         * Skip the sequence header, which uses two bytes for its length
+         * when longer than 127 bytes
+         */
+        let offset = 2;
+
+        if ord(substr(signature, 1, 1)) === 0x81 {
+            let offset = 3;
+        }
+
+        let length = ord(substr(signature, offset + 1, 1)),
+            r      = substr(signature, offset + 2, length),
+            offset = offset + 2 + length,
+            length = ord(substr(signature, offset + 1, 1)),
+            s      = substr(signature, offset + 2, length);
+
+        return this->toPart(r) . this->toPart(s);
+    }
+
+    /**
+     * Encodes a big endian unsigned value as a DER integer
+     */
+    private function toDerInteger(string! value) -> string
+    {
+        let value = ltrim(value, chr(0));
+
+        if value === "" || ord(substr(value, 0, 1)) > 0x7f {
+            let value = chr(0) . value;
+        }
+
+        return chr(0x02) . chr(strlen(value)) . value;
+    }
+
+    /**
+     * Pads or trims a DER integer to the length of R and S
+     */
+    private function toPart(string! value) -> string
+    {
+        let value = ltrim(value, chr(0));
+
+        return str_pad(value, this->partLength, chr(0), STR_PAD_LEFT);
+    }
+}
@@ -0,0 +1,56 @@
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+namespace Phalcon\Security\JWT\Signer;
+
+use Phalcon\Security\JWT\Exceptions\UnsupportedAlgorithmException;
+
+/**
+ * Class Rsa
+ *
+ * RSASSA-PKCS1-v1_5 signatures (RS256, RS384, RS512)
+ */
+class Rsa extends AbstractOpenSsl
+{
+    /**
+     * Rsa constructor.
+     *
+     * @param string $algo
+     *
+     * @throws UnsupportedAlgorithmException
+     */
+    public function __construct(string! algo = "sha256")
+    {
+        array supported;
+
+        let supported = [
+            "sha512" : 1,
+            "sha384" : 1,
+            "sha256" : 1
+        ];
+
+        if !isset supported[algo] {
+            throw new UnsupportedAlgorithmException(
+                "Unsupported RSA algorithm"
+            );
+        };
+
+        let this->algorithm = algo;
+    }
+
+    /**
+     * Return the value that is used for the "alg" header
+     *
+     * @return string
+     */
+    public function getAlgHeader() -> string
+    {
+        return "RS" . str_replace("sha", "", this->algorithm);
+    }
+}
@@ -23,6 +23,21 @@ use Phalcon\Security\JWT\Token\Token;
  */
 class Validator
 {
+    /**
+     * Maximum number of verified signatures kept in memory. The cache is
+     * disabled when zero
+     *
+     * @var int
+     */
+    protected static verifiedCacheSize = 0;
+
+    /**
+     * Verified signatures, with the time they stop being valid
+     *
+     * @var array
+     */
+    protected static verifiedSignatures = [];
+
     /**
      * @var int
      */
@@ -45,6 +60,19 @@ class Validator
             this->timeShift = timeShift;
     }
 
+    /**
+     * Sets the number of verified signatures kept in memory for the
+     * lifetime of the process. Only tokens inside their validity window are
+     * kept, until they expire. Set to zero to disable the cache
+     *
+     * @param int $size
+     */
+    public static function setVerifiedCacheSize(int size) -> void
+    {
+        let self::verifiedCacheSize  = size,
+            self::verifiedSignatures = [];
+    }
+
     /**
      * @param Token $token
      *
@@ -171,21 +199,80 @@ class Validator
      */
     public function validateSignature(<SignerInterface> signer, string passphrase) -> <Validator>
     {
-        if (
-            !signer->verify(
-                this->token->getSignature()->getHash(),
-                this->token->getPayload(),
-                passphrase
-            )
-        ) {
+        var expires;
+        string key, payload, signature;
+
+        let key       = "",
+            payload   = this->token->getPayload(),
+            signature = this->token->getSignature()->getHash();
+
+        /**
+         * The key covers the signer, the passphrase and the whole token, so
+         * that a cached result cannot be reused for other contents
+         */
+        if self::verifiedCacheSize > 0 {
+            let key = hash(
+                "sha256",
+                get_class(signer) . signer->getAlgHeader() . chr(0) .
+                passphrase . chr(0) . payload . "." . signature
+            );
+
+            if fetch expires, self::verifiedSignatures[key] {
+                if expires > time() {
+                    return this;
+                }
+            }
+        }
+
+        if (!signer->verify(signature, payload, passphrase)) {
             throw new ValidatorException(
                 "Validation: the signature does not match"
             );
         }
 
+        if self::verifiedCacheSize > 0 {
+            this->cacheSignature(key);
+        }
+
         return this;
     }
 
+    /**
+     * Keeps a verified signature when the token is currently valid, evicting
+     * the oldest entry when the cache is full
+     *
+     * @param string $key
+     */
+    private function cacheSignature(string! key) -> void
+    {
+        var claims, expires, notBefore;
+        array signatures;
+        int now;
+
+        let claims = this->token->getClaims(),
+            now    = time();
+
+        if !claims->has(Enum::EXPIRATION_TIME) {
+            return;
+        }
+
+        let expires   = (int) claims->get(Enum::EXPIRATION_TIME),
+            notBefore = (int) claims->get(Enum::NOT_BEFORE, 0);
+
+        if expires <= now || notBefore > now {
+            return;
+        }
+
+        let signatures = self::verifiedSignatures;
+
+        if !isset signatures[key] && count(signatures) >= self::verifiedCacheSize {
+            array_shift(signatures);
+        }
+
+        let signatures[key] = expires,
+            self::verifiedSignatures = signatures;
+    }
+
     /**
      * @param int $timestamp
      *
@@ -12,14 +12,22 @@ namespace Phalcon\Session\Adapter;
 
 use Phalcon\Storage\Adapter\AdapterInterface;
 use SessionHandlerInterface;
+use SessionUpdateTimestampHandlerInterface;
 
-abstract class AbstractAdapter implements SessionHandlerInterface
+abstract class AbstractAdapter implements SessionHandlerInterface, SessionUpdateTimestampHandlerInterface
 {
     /**
      * @var AdapterInterface
      */
     protected adapter;
 
+    /**
+     * Data read for each session, to skip writing it when it did not change
+     *
+     * @var array
+     */
+    protected payloads = [];
+
     /**
      * Close
      */
@@ -56,7 +64,13 @@ abstract class AbstractAdapter implements SessionHandlerInterface
         var data;
         let data = this->adapter->get(id);
 
-        return null === data ? "" : data;
+        if null === data {
+            let data = "";
+        }
+
+        let this->payloads[id] = data;
+
+        return data;
     }
 
     /**
@@ -68,10 +82,42 @@ abstract class AbstractAdapter implements SessionHandlerInterface
     }
 
     /**
-     * Write
+     * Update timestamp. Extends the lifetime of a session that did not change.
+     * The storage adapters cannot refresh the expiry alone, so the data is
+     * stored again; the Stream, Redis and Libmemcached session adapters
+     * override this to only refresh the expiry
+     */
+    public function updateTimestamp(var id, var data) -> bool
+    {
+        let this->payloads[id] = data;
+
+        return this->adapter->set(id, data);
+    }
+
+    /**
+     * Validate id. Checks that a session exists, used with
+     * `session.use_strict_mode`
+     */
+    public function validateId(var id) -> bool
+    {
+        return this->adapter->has(id);
+    }
+
+    /**
+     * Write. Only the expiry is updated when the data did not change
      */
     public function write(var id, var data) -> bool
     {
+        var payload;
+
+        if fetch payload, this->payloads[id] {
+            if payload === data {
+                return this->updateTimestamp(id, data);
+            }
+        }
+
+        let this->payloads[id] = data;
+
         return this->adapter->set(id, data);
     }
 }
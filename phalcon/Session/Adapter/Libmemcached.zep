@@ -18,6 +18,13 @@ use Phalcon\Helper\Arr;
  */
 class Libmemcached extends AbstractAdapter
 {
+    /**
+     * Lifetime of the sessions, in seconds
+     *
+     * @var int
+     */
+    protected lifetime = 3600;
+
     /**
      * Constructor
      *
@@ -39,6 +46,22 @@ class Libmemcached extends AbstractAdapter
     public function __construct(<AdapterFactory> factory, array! options = [])
     {
         let options["prefix"] = Arr::get(options, "prefix", "sess-memc-"),
+            this->lifetime    = (int) Arr::get(options, "lifetime", 3600),
             this->adapter     = factory->newInstance("libmemcached", options);
     }
+
+    /**
+     * Update timestamp. Extends the lifetime of the session with a touch,
+     * storing the data again only if the session expired
+     */
+    public function updateTimestamp(var id, var data) -> bool
+    {
+        let this->payloads[id] = data;
+
+        if this->adapter->getAdapter()->touch(id, this->lifetime) {
+            return true;
+        }
+
+        return this->adapter->set(id, data);
+    }
 }
@@ -11,6 +11,7 @@
 namespace Phalcon\Session\Adapter;
 
 use SessionHandlerInterface;
+use SessionUpdateTimestampHandlerInterface;
 
 /**
  * Phalcon\Session\Adapter\Noop
@@ -28,7 +29,7 @@ use SessionHandlerInterface;
  * $session->setAdapter(new Noop());
  * ```
  */
-class Noop implements SessionHandlerInterface
+class Noop implements SessionHandlerInterface, SessionUpdateTimestampHandlerInterface
 {
     /**
      * The connection of some adapters
@@ -117,6 +118,22 @@ class Noop implements SessionHandlerInterface
         return true;
     }
 
+    /**
+     * Update timestamp
+     */
+    public function updateTimestamp(var id, var data) -> bool
+    {
+        return true;
+    }
+
+    /**
+     * Validate id
+     */
+    public function validateId(var id) -> bool
+    {
+        return true;
+    }
+
     /**
      * Write
      */
@@ -18,6 +18,13 @@ use Phalcon\Helper\Arr;
  */
  class Redis extends AbstractAdapter
 {
+    /**
+     * Lifetime of the sessions, in seconds
+     *
+     * @var int
+     */
+    protected lifetime = 3600;
+
     /**
      * Constructor
      *
@@ -34,6 +41,22 @@ use Phalcon\Helper\Arr;
     public function __construct(<AdapterFactory> factory, array! options = [])
     {
         let options["prefix"] = Arr::get(options, "prefix", "sess-reds-"),
+            this->lifetime    = (int) Arr::get(options, "lifetime", 3600),
             this->adapter     = factory->newInstance("redis", options);
     }
+
+    /**
+     * Update timestamp. Extends the lifetime of the session with EXPIRE,
+     * storing the data again only if the session expired
+     */
+    public function updateTimestamp(var id, var data) -> bool
+    {
+        let this->payloads[id] = data;
+
+        if this->adapter->getAdapter()->expire(id, this->lifetime) {
+            return true;
+        }
+
+        return this->adapter->set(id, data);
+    }
 }
@@ -40,6 +40,13 @@ class Stream extends Noop
      */
     private path = "";
 
+    /**
+     * Data read for each session, to skip writing it when it did not change
+     *
+     * @var array
+     */
+    private payloads = [];
+
     /**
      * Constructor
      *
@@ -132,19 +139,59 @@ class Stream extends Noop
             fclose(pointer);
 
             if false === data {
-                return "";
+                let data = "";
             }
         }
 
+        let this->payloads[id] = data;
+
         return data;
     }
 
-    public function write(var id, var data) -> bool
+    /**
+     * Updates the modification time of the file, used by the garbage
+     * collector, without writing the data again
+     */
+    public function updateTimestamp(var id, var data) -> bool
     {
         var name;
 
         let name = this->path . this->getPrefixedName(id);
 
+        if file_exists(name) && touch(name) {
+            return true;
+        }
+
+        return this->write(id, data);
+    }
+
+    /**
+     * Checks that the file of a session exists
+     */
+    public function validateId(var id) -> bool
+    {
+        return file_exists(this->path . this->getPrefixedName(id));
+    }
+
+    /**
+     * Writes the data, or only updates the modification time of the file if
+     * the data did not change
+     */
+    public function write(var id, var data) -> bool
+    {
+        var name, payload;
+
+        if fetch payload, this->payloads[id] {
+            if payload === data {
+                unset this->payloads[id];
+
+                return this->updateTimestamp(id, data);
+            }
+        }
+
+        let name               = this->path . this->getPrefixedName(id),
+            this->payloads[id] = data;
+
         return false !== file_put_contents(name, data, LOCK_EX);
     }
 }
@@ -29,6 +29,15 @@ class Manager extends AbstractInjectionAware implements ManagerInterface
      */
     private adapter = null;
 
+    /**
+     * Start the session on the first access instead of in start(). Writing to
+     * a lazy session which cannot be started, i.e. because the headers have
+     * already been sent, throws an exception
+     *
+     * @var bool
+     */
+    private lazy = false;
+
     /**
      * @var string
      */
@@ -39,6 +48,29 @@ class Manager extends AbstractInjectionAware implements ManagerInterface
      */
     private options = [];
 
+    /**
+     * Whether start() was called in lazy mode and the session was not
+     * opened yet
+     *
+     * @var bool
+     */
+    private pending = false;
+
+    /**
+     * Read the session data and release the session immediately, the changes
+     * are not stored
+     *
+     * @var bool
+     */
+    private readOnly = false;
+
+    /**
+     * Whether the data of a read only session has been read
+     *
+     * @var bool
+     */
+    private readOnlyStarted = false;
+
     /**
      * @var string
      */
@@ -48,8 +80,15 @@ class Manager extends AbstractInjectionAware implements ManagerInterface
      * Manager constructor.
      *
      * @param array options = [
-     *     'uniqueId' => null
+     *     'uniqueId' => null,
+     *     'lazy'     => false,
+     *     'readOnly' => false
      * ]
+     *
+     * With `lazy` the session is started by the first set(), remove() or
+     * regenerateId(), or by a read on a request carrying the session cookie.
+     * Headers may have been sent by then, in which case the write throws an
+     * exception instead of losing the data.
      */
     public function __construct(array options = [])
     {
@@ -98,6 +137,13 @@ class Manager extends AbstractInjectionAware implements ManagerInterface
 
             let _SESSION = [];
         }
+
+        if this->readOnlyStarted {
+            let _SESSION = [];
+        }
+
+        let this->pending         = false,
+            this->readOnlyStarted = false;
     }
 
     /**
@@ -115,7 +161,7 @@ class Manager extends AbstractInjectionAware implements ManagerInterface
     {
         var uniqueKey, value = null;
 
-        if false === this->exists() {
+        if false === this->isStarted(false) {
             // To use $_SESSION variable we need to start session first
             return value;
         }
@@ -165,7 +211,7 @@ class Manager extends AbstractInjectionAware implements ManagerInterface
     {
         var uniqueKey;
 
-        if false === this->exists() {
+        if false === this->isStarted(false) {
             // To use $_SESSION variable we need to start session first
             return false;
         }
@@ -192,7 +238,7 @@ class Manager extends AbstractInjectionAware implements ManagerInterface
 
         let delete = (bool) deleteOldSession;
 
-        if true === this->exists() {
+        if true === this->isStarted(true) && true === this->exists() {
             session_regenerate_id(delete);
         }
 
@@ -204,7 +250,7 @@ class Manager extends AbstractInjectionAware implements ManagerInterface
      */
     public function remove(string key) -> void
     {
-        if false === this->exists() {
+        if false === this->isStarted(true) {
             // To use $_SESSION variable we need to start session first
             return;
         }
@@ -223,7 +269,7 @@ class Manager extends AbstractInjectionAware implements ManagerInterface
     {
         var uniqueKey;
 
-        if false === this->exists() {
+        if false === this->isStarted(true) {
             // To use $_SESSION variable we need to start session first
             return;
         }
@@ -296,6 +342,8 @@ class Manager extends AbstractInjectionAware implements ManagerInterface
     public function setOptions(array options) -> void
     {
         let this->uniqueId = Arr::get(options, "uniqueId", ""),
+            this->lazy     = (bool) Arr::get(options, "lazy", false),
+            this->readOnly = (bool) Arr::get(options, "readOnly", false),
             this->options  = options;
     }
 
@@ -312,7 +360,7 @@ class Manager extends AbstractInjectionAware implements ManagerInterface
         /**
          * Check if the session exists
          */
-        if true === this->exists() {
+        if true === this->exists() || this->readOnlyStarted || this->pending {
             return true;
         }
 
@@ -338,14 +386,15 @@ class Manager extends AbstractInjectionAware implements ManagerInterface
         }
 
         /**
-         * Register the adapter
+         * In lazy mode the session is opened when it is first used
          */
-        session_set_save_handler(this->adapter);
+        if this->lazy {
+            let this->pending = true;
 
-        /**
-         * Start the session
-         */
-        return session_start();
+            return true;
+        }
+
+        return this->open();
     }
 
     /**
@@ -368,6 +417,80 @@ class Manager extends AbstractInjectionAware implements ManagerInterface
         return self::SESSION_NONE;
     }
 
+    /**
+     * Checks if the session data can be used, opening a lazy session. A lazy
+     * session is not opened to read when the request has no session cookie
+     *
+     * @throws Exception when a lazy session cannot be opened to write
+     */
+    private function isStarted(bool write) -> bool
+    {
+        if true === this->exists() || this->readOnlyStarted {
+            return true;
+        }
+
+        if !this->pending {
+            return false;
+        }
+
+        if !write && !isset _COOKIE[this->getName()] {
+            return false;
+        }
+
+        if unlikely !this->open() {
+            if write {
+                throw new Exception(
+                    "The session could not be started to store the data. " .
+                    "The headers may have already been sent"
+                );
+            }
+
+            return false;
+        }
+
+        let this->pending = false;
+
+        return true;
+    }
+
+    /**
+     * Registers the adapter and starts the session. Read only sessions are
+     * closed as soon as the data is read, releasing the lock of the adapter
+     */
+    private function open() -> bool
+    {
+        bool result;
+
+        /**
+         * Cannot start this - headers already sent
+         */
+        if true === headers_sent() {
+            return false;
+        }
+
+        /**
+         * Register the adapter
+         */
+        session_set_save_handler(this->adapter);
+
+        if this->readOnly {
+            let result = session_start(
+                [
+                    "read_and_close" : true
+                ]
+            );
+
+            let this->readOnlyStarted = result;
+
+            return result;
+        }
+
+        /**
+         * Start the session
+         */
+        return session_start();
+    }
+
     /**
      * Returns the key prefixed
      */
@@ -13,6 +13,7 @@ namespace Phalcon\Storage\Adapter;
 use FilesystemIterator;
 use Iterator;
 use Phalcon\Helper\Arr;
+use Phalcon\Helper\Fs;
 use Phalcon\Helper\Str;
 use Phalcon\Storage\Exception;
 use Phalcon\Storage\SerializerFactory;
@@ -74,15 +75,23 @@ class Stream extends AbstractAdapter
      */
     public function clear() -> bool
     {
-        var directory, iterator, file;
+        var directory, iterator, file, temporaryDir;
         bool result;
 
-        let result    = true,
-            directory = Str::dirSeparator(this->storageDir),
-            iterator  = this->getIterator(directory);
+        let result       = true,
+            directory    = Str::dirSeparator(this->storageDir),
+            temporaryDir = this->getTemporaryDir(),
+            iterator     = this->getIterator(directory);
 
+        /**
+         * Files being written by set() are left in place
+         */
         for file in iterator {
-            if file->isFile() && !unlink(file->getPathName()) {
+            if !file->isFile() || Str::dirSeparator(file->getPath()) === temporaryDir {
+                continue;
+            }
+
+            if !unlink(file->getPathName()) {
                 let result = false;
             }
         }
@@ -101,16 +110,7 @@ class Stream extends AbstractAdapter
      */
     public function decrement(string! key, int value = 1) -> int | bool
     {
-        var data;
-
-        if !this->has(key) {
-            return false;
-        }
-
-        let data = this->get(key),
-            data = (int) data - value;
-
-        return this->set(key, data);
+        return this->increment(key, -value);
     }
 
     /**
@@ -122,15 +122,25 @@ class Stream extends AbstractAdapter
      */
     public function delete(string! key) -> bool
     {
-        var filepath;
+        var filepath, pointer;
+        bool result;
 
         if !this->has(key) {
             return false;
         }
 
-        let filepath = this->getFilepath(key);
+        let filepath = this->getFilepath(key),
+            pointer  = this->lock(filepath);
+
+        if unlikely pointer === false {
+            return false;
+        }
 
-        return unlink(filepath);
+        let result = unlink(filepath);
+
+        this->unlock(pointer);
+
+        return result;
     }
 
     /**
@@ -143,11 +153,7 @@ class Stream extends AbstractAdapter
      */
     public function get(string! key, var defaultValue = null) -> var
     {
-        var content, filepath, payload;
-
-        if this->has(key) == false {
-            return defaultValue;
-        }
+        var filepath, payload;
 
         let filepath = this->getFilepath(key);
 
@@ -155,19 +161,20 @@ class Stream extends AbstractAdapter
             return defaultValue;
         }
 
-        let payload = this->getPayload(filepath);
+        /**
+         * The file is read once, the expiry is in its header
+         */
+        let payload = this->getPayload(file_get_contents(filepath));
 
         if unlikely empty payload {
             return defaultValue;
         }
 
-        if this->isExpired(payload) {
+        if this->isExpired(payload["expires"]) {
             return defaultValue;
         }
 
-        let content = Arr::get(payload, "content", null);
-
-        return this->getUnserializedData(content);
+        return payload["content"];
     }
 
     /**
@@ -215,7 +222,7 @@ class Stream extends AbstractAdapter
      */
     public function has(string! key) -> bool
     {
-        var payload, filepath;
+        var filepath, header, pointer;
 
         let filepath = this->getFilepath(key);
 
@@ -223,13 +230,24 @@ class Stream extends AbstractAdapter
             return false;
         }
 
-        let payload = this->getPayload(filepath);
+        /**
+         * Only the header is read, the payload is not unserialized
+         */
+        let pointer = fopen(filepath, "rb");
 
-        if unlikely empty payload {
+        if unlikely pointer === false {
+            return false;
+        }
+
+        let header = this->getHeader(fread(pointer, 12));
+
+        fclose(pointer);
+
+        if unlikely empty header {
             return false;
         }
 
-        return !this->isExpired(payload);
+        return !this->isExpired(header["expires"]);
     }
 
     /**
@@ -243,16 +261,37 @@ class Stream extends AbstractAdapter
      */
     public function increment(string! key, int value = 1) -> int | bool
     {
-        var data;
+        var filepath, payload, pointer, data;
+        bool result;
 
-        if !this->has(key) {
+        let filepath = this->getFilepath(key),
+            pointer  = this->lock(filepath);
+
+        if pointer === false {
             return false;
         }
 
-        let data = this->get(key),
-            data = (int) data + value;
+        let payload = this->getPayload(stream_get_contents(pointer));
+
+        if empty payload || this->isExpired(payload["expires"]) {
+            this->unlock(pointer);
 
-        return this->set(key, data);
+            return false;
+        }
+
+        let data   = (int) payload["content"] + value,
+            result = this->write(
+                filepath,
+                this->getFileContents(data, payload["expires"])
+            );
+
+        this->unlock(pointer);
+
+        if unlikely !result {
+            return false;
+        }
+
+        return data;
     }
 
     /**
@@ -267,22 +306,30 @@ class Stream extends AbstractAdapter
      */
     public function set(string! key, var value, var ttl = null) -> bool
     {
-        var directory;
-        array payload;
+        var directory, pointer;
+        bool result;
 
-        let payload   = [
-                "created" : time(),
-                "ttl"     : this->getTtl(ttl),
-                "content" : this->getSerializedData(value)
-            ],
-            payload   = serialize(payload),
-            directory = this->getDir(key);
+        let directory = this->getDir(key);
 
         if !is_dir(directory) {
             mkdir(directory, 0777, true);
         }
 
-        return false !== file_put_contents(directory . key, payload, LOCK_EX);
+        /**
+         * An existing entry is locked, so that the value is not replaced
+         * while an increment() or a decrement() is rewriting it
+         */
+        let pointer = this->lock(directory . key),
+            result  = this->write(
+                directory . key,
+                this->getFileContents(value, time() + this->getTtl(ttl))
+            );
+
+        if pointer !== false {
+            this->unlock(pointer);
+        }
+
+        return result;
     }
 
     /**
@@ -326,24 +373,68 @@ class Stream extends AbstractAdapter
        );
     }
 
+    /**
+     * Returns the contents of a file: a fixed size header holding the format
+     * and the expiry timestamp, followed by the serialized value. Values are
+     * serialized with the PHP serializer when there is no serializer and they
+     * are not strings
+     */
+    private function getFileContents(var value, int expires) -> string
+    {
+        var content, format;
+
+        let content = this->getSerializedData(value),
+            format  = "s";
+
+        if typeof content != "string" {
+            let content = serialize(content),
+                format  = "p";
+        }
+
+        return pack("a3aJ", "phs", format, expires) . content;
+    }
+
+    /**
+     * Parses the header of a file, returning an empty array if it is not valid
+     */
+    private function getHeader(var header) -> array
+    {
+        var parts;
+
+        if typeof header != "string" || strlen(header) < 12 || substr(header, 0, 3) !== "phs" {
+            return [];
+        }
+
+        let parts = unpack("a3magic/aformat/Jexpires", header);
+
+        if unlikely typeof parts != "array" {
+            return [];
+        }
+
+        return parts;
+    }
+
     /**
      * Gets the file contents and returns an array or an error if something
      * went wrong
      */
-    private function getPayload(string filepath) -> array
+    private function getPayload(var contents) -> array
     {
-        var payload, pointer, version;
+        var content, header, version;
 
-        let pointer = fopen(filepath, 'r');
+        let header = this->getHeader(contents);
 
-        if (flock(pointer, LOCK_SH)) {
-            let payload = file_get_contents(filepath);
+        if unlikely empty header {
+            return [];
         }
 
-        fclose(pointer);
+        let content = (string) substr(contents, 12);
 
-        if false === payload {
-            return [];
+        if header["format"] !== "p" {
+            return [
+                "expires" : header["expires"],
+                "content" : this->getUnserializedData(content)
+            ];
         }
 
         let version = phpversion();
@@ -365,31 +456,94 @@ class Stream extends AbstractAdapter
             );
         }
 
-        let payload = unserialize(payload);
+        let content = unserialize(content);
 
         restore_error_handler();
 
-        if unlikely (globals_get("warning.enable") || typeof payload !== "array") {
+        if unlikely globals_get("warning.enable") {
             return [];
         }
 
-        return payload;
+        return [
+            "expires" : header["expires"],
+            "content" : content
+        ];
+    }
+
+    /**
+     * Returns the folder holding the files being written, outside of the
+     * folder of the keys
+     */
+    private function getTemporaryDir() -> string
+    {
+        return Str::dirSeparator(this->storageDir . this->prefix . "-tmp");
     }
 
     /**
      * Returns if the cache has expired for this item or not
-     *
-     * @param array $payload
-     *
-     * @return bool
      */
-    private function isExpired(array! payload) -> bool
+    private function isExpired(int expires) -> bool
     {
-        var created, ttl;
+        return expires < time();
+    }
+
+    /**
+     * Opens and exclusively locks a file, returning false if it does not
+     * exist. The file may have been replaced while waiting for the lock, in
+     * which case the new file is locked instead
+     */
+    private function lock(string! filepath) -> var
+    {
+        var pointer, stat;
+
+        loop {
+            if !file_exists(filepath) {
+                return false;
+            }
+
+            let pointer = fopen(filepath, "rb");
 
-        let created = Arr::get(payload, "created", time()),
-            ttl     = Arr::get(payload, "ttl", 3600);
+            if unlikely pointer === false {
+                return false;
+            }
+
+            flock(pointer, LOCK_EX);
+            clearstatcache(true, filepath);
+
+            let stat = fstat(pointer);
+
+            if file_exists(filepath) && fileinode(filepath) === stat["ino"] {
+                return pointer;
+            }
+
+            this->unlock(pointer);
+        }
+    }
+
+    /**
+     * Releases and closes a file locked by lock()
+     */
+    private function unlock(var pointer) -> void
+    {
+        flock(pointer, LOCK_UN);
+        fclose(pointer);
+    }
+
+    /**
+     * Writes the contents to a temporary file, renamed to the file so that
+     * readers never see a partially written entry. The temporary files are
+     * kept in their own folder, out of the way of getKeys()
+     */
+    private function write(string! filepath, string! contents) -> bool
+    {
+        var temporaryDir;
+
+        let temporaryDir = this->getTemporaryDir();
+
+        if !is_dir(temporaryDir) {
+            mkdir(temporaryDir, 0777, true);
+        }
 
-        return (created + ttl) < time();
+        return Fs::write(filepath, contents, temporaryDir, false);
     }
 }
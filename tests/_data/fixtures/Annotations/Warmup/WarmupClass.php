@@ -0,0 +1,27 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Test\Fixtures\Annotations\Warmup;
+
+/**
+ * @RoutePrefix("/warmup")
+ */
+class WarmupClass
+{
+    /**
+     * @Get("/")
+     */
+    public function indexAction()
+    {
+    }
+}
@@ -0,0 +1,17 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+/**
+ * Not a class file, warmup() must not execute it
+ */
+throw new RuntimeException('The routes file has been executed');
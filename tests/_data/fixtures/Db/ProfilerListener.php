@@ -33,7 +33,9 @@ class ProfilerListener
 
     public function afterQuery($event, $connection)
     {
-        $this->profiler->stopProfile();
+        $this->profiler->stopProfile(
+            $connection->isStatementCached()
+        );
     }
 
     public function getProfiler()
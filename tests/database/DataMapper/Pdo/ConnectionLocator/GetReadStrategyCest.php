@@ -0,0 +1,91 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Test\Database\DataMapper\Pdo\ConnectionLocator;
+
+use DatabaseTester;
+use Phalcon\DataMapper\Pdo\Connection;
+use Phalcon\DataMapper\Pdo\ConnectionLocator;
+use Phalcon\Db\ReplicaStrategy;
+
+use function outputDir;
+use function spl_object_hash;
+use function uniqid;
+
+class GetReadStrategyCest
+{
+    /**
+     * Database Tests Phalcon\DataMapper\Pdo\ConnectionLocator :: getRead() -
+     * replica strategy
+     *
+     * @since  2021-07-07
+     *
+     * @group  common
+     */
+    public function dMPdoConnectionLocatorGetReadStrategy(DatabaseTester $I)
+    {
+        $I->wantToTest('DataMapper\Pdo\ConnectionLocator - getRead() - replica strategy');
+
+        $master  = new Connection('sqlite::memory:');
+        $replica = new Connection('sqlite::memory:');
+        $missing = outputDir(uniqid('missing-') . '/replica.sqlite');
+
+        $strategy = new ReplicaStrategy();
+        $locator  = new ConnectionLocator(
+            $master,
+            [
+                'down' => function () use ($missing) {
+                    return new Connection('sqlite:' . $missing);
+                },
+                'up'   => function () use ($replica) {
+                    return $replica;
+                },
+            ]
+        );
+        $locator->setStrategy($strategy);
+
+        /**
+         * The replica failing to connect is marked down and, with no replica
+         * left, the master is returned
+         */
+        $strategy->markDown('up');
+
+        $actual = $locator->getRead();
+        $I->assertEquals(spl_object_hash($master), spl_object_hash($actual));
+        $I->assertTrue($strategy->isDown('down'));
+
+        /**
+         * The replica down is never returned again
+         */
+        $strategy->markUp('up');
+
+        for ($i = 0; $i < 10; $i++) {
+            $actual = $locator->getRead();
+
+            $I->assertEquals(spl_object_hash($replica), spl_object_hash($actual));
+        }
+
+        $I->assertFalse($strategy->isDown('up'));
+
+        /**
+         * Sticky reads after a write
+         */
+        $strategy->setSticky(true);
+
+        $actual = $locator->getRead();
+        $I->assertEquals(spl_object_hash($replica), spl_object_hash($actual));
+
+        $locator->getWrite();
+
+        $actual = $locator->getRead();
+        $I->assertEquals(spl_object_hash($master), spl_object_hash($actual));
+    }
+}
@@ -0,0 +1,142 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the
+ * LICENSE.txt file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Test\Database\Db\Adapter\Pdo;
+
+use DatabaseTester;
+use Phalcon\Db\Adapter\Pdo\AbstractPdo;
+use Phalcon\Db\Column;
+use Phalcon\Storage\Exception;
+use Phalcon\Test\Fixtures\Migrations\InvoicesMigration;
+use Phalcon\Test\Fixtures\Traits\DiTrait;
+
+use function range;
+
+class InsertMultipleCest
+{
+    use DiTrait;
+
+    /**
+     * Executed before each test
+     *
+     * @param DatabaseTester $I
+     *
+     * @return void
+     */
+    public function _before(DatabaseTester $I): void
+    {
+        try {
+            $this->setNewFactoryDefault();
+        } catch (Exception $e) {
+            $I->fail($e->getMessage());
+        }
+
+        $this->setDatabase($I);
+
+        (new InvoicesMigration($I->getConnection()))->clear();
+    }
+
+    /**
+     * Tests Phalcon\Db\Adapter\Pdo :: insertMultiple()
+     *
+     * @param DatabaseTester $I
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2021-07-07
+     *
+     * @group  mysql
+     * @group  pgsql
+     * @group  sqlite
+     */
+    public function dbAdapterPdoInsertMultiple(DatabaseTester $I)
+    {
+        $I->wantToTest('Db\Adapter\Pdo - insertMultiple()');
+
+        /** @var AbstractPdo $db */
+        $db = $this->container->get('db');
+
+        /**
+         * More rows than SQLite accepts placeholders in a single statement
+         */
+        $rows = [];
+        foreach (range(1, 600) as $id) {
+            $rows[] = [$id, 1, 'title-' . $id];
+        }
+
+        $actual = $db->insertMultiple(
+            'co_invoices',
+            $rows,
+            ['inv_id', 'inv_cst_id', 'inv_title'],
+            [Column::BIND_PARAM_INT, Column::BIND_PARAM_INT, Column::BIND_PARAM_STR]
+        );
+        $I->assertTrue($actual);
+
+        $I->assertEquals(
+            600,
+            $db->fetchColumn('SELECT COUNT(*) FROM co_invoices')
+        );
+        $I->assertEquals(
+            'title-600',
+            $db->fetchColumn('SELECT inv_title FROM co_invoices WHERE inv_id = 600')
+        );
+    }
+
+    /**
+     * Tests Phalcon\Db\Adapter\Pdo :: upsertMultiple()
+     *
+     * @param DatabaseTester $I
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2021-07-07
+     *
+     * @group  mysql
+     * @group  pgsql
+     * @group  sqlite
+     */
+    public function dbAdapterPdoUpsertMultiple(DatabaseTester $I)
+    {
+        $I->wantToTest('Db\Adapter\Pdo - upsertMultiple()');
+
+        /** @var AbstractPdo $db */
+        $db = $this->container->get('db');
+
+        $db->insertMultiple(
+            'co_invoices',
+            [
+                [1, 'one'],
+                [2, 'two'],
+            ],
+            ['inv_id', 'inv_title']
+        );
+
+        $actual = $db->upsertMultiple(
+            'co_invoices',
+            [
+                [2, 'two-updated'],
+                [3, 'three'],
+            ],
+            ['inv_id', 'inv_title'],
+            ['inv_id']
+        );
+        $I->assertTrue($actual);
+
+        $I->assertEquals(
+            [
+                ['inv_id' => 1, 'inv_title' => 'one'],
+                ['inv_id' => 2, 'inv_title' => 'two-updated'],
+                ['inv_id' => 3, 'inv_title' => 'three'],
+            ],
+            $db->fetchAll('SELECT inv_id, inv_title FROM co_invoices ORDER BY inv_id')
+        );
+    }
+}
@@ -0,0 +1,172 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the
+ * LICENSE.txt file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Test\Database\Db\Adapter\Pdo;
+
+use DatabaseTester;
+use Phalcon\Db\Adapter\Pdo\AbstractPdo;
+use Phalcon\Db\Profiler;
+use Phalcon\Events\Event;
+use Phalcon\Events\Manager as EventsManager;
+use Phalcon\Storage\Exception;
+use Phalcon\Test\Fixtures\Migrations\InvoicesMigration;
+use Phalcon\Test\Fixtures\Traits\DiTrait;
+
+use function get_class;
+
+class StatementCacheCest
+{
+    use DiTrait;
+
+    /**
+     * Executed before each test
+     *
+     * @param DatabaseTester $I
+     *
+     * @return void
+     */
+    public function _before(DatabaseTester $I): void
+    {
+        try {
+            $this->setNewFactoryDefault();
+        } catch (Exception $e) {
+            $I->fail($e->getMessage());
+        }
+
+        $this->setDatabase($I);
+
+        $migration = new InvoicesMigration($I->getConnection());
+        $migration->clear();
+        $migration->insert(1, 1, 1, 'one');
+        $migration->insert(2, 1, 1, 'two');
+    }
+
+    /**
+     * Tests Phalcon\Db\Adapter\Pdo :: query() - statement cache
+     *
+     * @param DatabaseTester $I
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2021-07-07
+     *
+     * @group  mysql
+     * @group  pgsql
+     * @group  sqlite
+     */
+    public function dbAdapterPdoStatementCache(DatabaseTester $I)
+    {
+        $I->wantToTest('Db\Adapter\Pdo - query() - statement cache');
+
+        $db  = $this->newCachingConnection($I, 2);
+        $sql = 'SELECT inv_title FROM co_invoices WHERE inv_id = ?';
+
+        $result = $db->query($sql, [1]);
+        $I->assertFalse($db->isStatementCached());
+        $I->assertEquals('one', $result->fetch()['inv_title']);
+        unset($result);
+
+        $result = $db->query($sql, [2]);
+        $I->assertTrue($db->isStatementCached());
+        $I->assertEquals('two', $result->fetch()['inv_title']);
+
+        /**
+         * The statement is not reused while a result holds it
+         */
+        $other = $db->query($sql, [1]);
+        $I->assertFalse($db->isStatementCached());
+        $I->assertEquals('one', $other->fetch()['inv_title']);
+
+        unset($result, $other);
+
+        /**
+         * The least recently used statement is evicted
+         */
+        $db->query('SELECT inv_id FROM co_invoices WHERE inv_id = ?', [1]);
+        $db->query('SELECT inv_cst_id FROM co_invoices WHERE inv_id = ?', [1]);
+
+        $expected = [
+            'hits'      => 1,
+            'misses'    => 4,
+            'evictions' => 1,
+            'size'      => 2,
+            'capacity'  => 2,
+        ];
+        $I->assertEquals($expected, $db->getStatementCacheStats());
+
+        /**
+         * Reconnecting clears the cache
+         */
+        $db->connect();
+        $I->assertEquals(0, $db->getStatementCacheStats()['size']);
+    }
+
+    /**
+     * Tests Phalcon\Db\Profiler :: getNumberCachedStatements()
+     *
+     * @param DatabaseTester $I
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2021-07-07
+     *
+     * @group  mysql
+     * @group  pgsql
+     * @group  sqlite
+     */
+    public function dbProfilerGetNumberCachedStatements(DatabaseTester $I)
+    {
+        $I->wantToTest('Db\Profiler - getNumberCachedStatements()');
+
+        $db       = $this->newCachingConnection($I, 10);
+        $profiler = new Profiler();
+        $manager  = new EventsManager();
+
+        $manager->attach(
+            'db',
+            function (Event $event, AbstractPdo $connection) use ($profiler) {
+                if ($event->getType() === 'beforeQuery') {
+                    $profiler->startProfile($connection->getSQLStatement());
+                }
+
+                if ($event->getType() === 'afterQuery') {
+                    $profiler->stopProfile($connection->isStatementCached());
+                }
+            }
+        );
+
+        $db->setEventsManager($manager);
+
+        $db->execute('UPDATE co_invoices SET inv_total = ? WHERE inv_id = ?', [10, 1]);
+        $db->execute('UPDATE co_invoices SET inv_total = ? WHERE inv_id = ?', [20, 2]);
+        $db->execute('UPDATE co_invoices SET inv_total = ? WHERE inv_id = ?', [30, 1]);
+
+        $I->assertEquals(3, $profiler->getNumberTotalStatements());
+        $I->assertEquals(2, $profiler->getNumberCachedStatements());
+        $I->assertFalse($profiler->getProfiles()[0]->isStatementCached());
+        $I->assertTrue($profiler->getProfiles()[2]->isStatementCached());
+    }
+
+    /**
+     * Returns a connection like the "db" service with the statement cache
+     * enabled
+     */
+    private function newCachingConnection(DatabaseTester $I, int $size): AbstractPdo
+    {
+        $db         = $this->newDbService($I);
+        $descriptor = $db->getDescriptor();
+        $class      = get_class($db);
+
+        $descriptor['statementCacheSize'] = $size;
+
+        return new $class($descriptor);
+    }
+}
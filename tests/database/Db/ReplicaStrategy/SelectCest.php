@@ -0,0 +1,94 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Test\Database\Db\ReplicaStrategy;
+
+use DatabaseTester;
+use Phalcon\Db\ReplicaStrategy;
+
+class SelectCest
+{
+    /**
+     * Tests Phalcon\Db\ReplicaStrategy :: select()
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2021-07-07
+     *
+     * @group  common
+     */
+    public function dbReplicaStrategySelect(DatabaseTester $I)
+    {
+        $I->wantToTest('Db\ReplicaStrategy - select()');
+
+        $strategy = new ReplicaStrategy(
+            [
+                'replica1' => 3,
+                'replica2' => 0,
+            ]
+        );
+        $names    = ['replica1', 'replica2', 'replica3'];
+
+        $selected = [];
+        for ($i = 0; $i < 50; $i++) {
+            $selected[$strategy->select($names)] = true;
+        }
+
+        $I->assertArrayNotHasKey('replica2', $selected);
+
+        /**
+         * Down replicas are skipped with a growing backoff
+         */
+        $strategy->markDown('replica1');
+
+        $I->assertTrue($strategy->isDown('replica1'));
+        $I->assertEquals('replica3', $strategy->select($names));
+
+        $strategy->markDown('replica3');
+
+        $I->assertNull($strategy->select($names));
+
+        $strategy->markUp('replica1');
+
+        $I->assertFalse($strategy->isDown('replica1'));
+        $I->assertEquals('replica1', $strategy->select($names));
+    }
+
+    /**
+     * Tests Phalcon\Db\ReplicaStrategy :: shouldUseMaster()
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2021-07-07
+     *
+     * @group  common
+     */
+    public function dbReplicaStrategyShouldUseMaster(DatabaseTester $I)
+    {
+        $I->wantToTest('Db\ReplicaStrategy - shouldUseMaster()');
+
+        $strategy = new ReplicaStrategy();
+        $strategy->recordWrite();
+
+        $I->assertFalse($strategy->shouldUseMaster());
+
+        $strategy->setSticky(true);
+
+        $I->assertTrue($strategy->shouldUseMaster());
+
+        $strategy
+            ->setSticky(true, 5)
+            ->setLastWrite(microtime(true) - 10)
+        ;
+
+        $I->assertFalse($strategy->shouldUseMaster());
+    }
+}
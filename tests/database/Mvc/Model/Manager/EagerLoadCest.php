@@ -0,0 +1,202 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Test\Database\Mvc\Model\Manager;
+
+use DatabaseTester;
+use PDO;
+use Phalcon\Mvc\Model\Exception;
+use Phalcon\Mvc\Model\Resultset\Simple;
+use Phalcon\Test\Fixtures\Migrations\CustomersMigration;
+use Phalcon\Test\Fixtures\Migrations\InvoicesMigration;
+use Phalcon\Test\Fixtures\Traits\DiTrait;
+use Phalcon\Test\Models\Customers;
+use Phalcon\Test\Models\Invoices;
+
+class EagerLoadCest
+{
+    use DiTrait;
+
+    public function _before(DatabaseTester $I)
+    {
+        $this->setNewFactoryDefault();
+        $this->setDatabase($I);
+
+        /** @var PDO $connection */
+        $connection = $I->getConnection();
+
+        $customersMigration = new CustomersMigration($connection);
+        $customersMigration->clear();
+        $customersMigration->insert(1, 1, 'one', 'one');
+        $customersMigration->insert(2, 1, 'two', 'two');
+        $customersMigration->insert(3, 1, 'three', 'three');
+
+        $invoicesMigration = new InvoicesMigration($connection);
+        $invoicesMigration->clear();
+        $invoicesMigration->insert(1, 1, Invoices::STATUS_PAID, 'one-paid');
+        $invoicesMigration->insert(2, 1, Invoices::STATUS_UNPAID, 'one-unpaid');
+        $invoicesMigration->insert(3, 2, Invoices::STATUS_PAID, 'two-paid');
+    }
+
+    /**
+     * Tests Phalcon\Mvc\Model\Manager :: eagerLoad() - with find()
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2021-07-07
+     *
+     * @group  mysql
+     * @group  pgsql
+     * @group  sqlite
+     */
+    public function mvcModelManagerEagerLoadFind(DatabaseTester $I)
+    {
+        $I->wantToTest('Mvc\Model\Manager - eagerLoad() - find()');
+
+        $customers = Customers::find(
+            [
+                'order' => 'cst_id',
+                'with'  => ['invoices', 'camelCaseInvoices', 'paidInvoices'],
+            ]
+        );
+
+        /**
+         * The relations are already in memory, removing the invoices
+         * proves no further query is issued
+         */
+        $I->getConnection()->exec('DELETE FROM co_invoices');
+
+        $expected = [
+            1 => [2, 1],
+            2 => [1, 1],
+            3 => [0, 0],
+        ];
+
+        foreach ($customers as $customer) {
+            $I->assertTrue($customer->isRelationshipLoaded('invoices'));
+            $I->assertTrue($customer->isRelationshipLoaded('camelCaseInvoices'));
+
+            $invoices = $customer->invoices;
+
+            $I->assertInstanceOf(Simple::class, $invoices);
+            $I->assertCount($expected[$customer->cst_id][0], $invoices);
+            $I->assertCount(
+                $expected[$customer->cst_id][0],
+                $customer->getRelated('camelCaseInvoices')
+            );
+            $I->assertCount(
+                $expected[$customer->cst_id][1],
+                $customer->paidInvoices
+            );
+
+            foreach ($invoices as $invoice) {
+                $I->assertInstanceOf(Invoices::class, $invoice);
+                $I->assertEquals($customer->cst_id, $invoice->inv_cst_id);
+            }
+        }
+    }
+
+    /**
+     * Tests Phalcon\Mvc\Model\Manager :: eagerLoad() - empty has one
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2021-07-07
+     *
+     * @group  mysql
+     * @group  pgsql
+     * @group  sqlite
+     */
+    public function mvcModelManagerEagerLoadEmptyHasOne(DatabaseTester $I)
+    {
+        $I->wantToTest('Mvc\Model\Manager - eagerLoad() - empty has one');
+
+        $invoicesMigration = new InvoicesMigration($I->getConnection());
+        $invoicesMigration->insert(4, 99, Invoices::STATUS_PAID, 'no-customer');
+
+        $invoices = Invoices::find(
+            [
+                'order' => 'inv_id',
+                'with'  => 'customer',
+            ]
+        );
+
+        $I->getConnection()->exec('DELETE FROM co_customers');
+
+        foreach ($invoices as $invoice) {
+            $I->assertTrue($invoice->isRelationshipLoaded('customer'));
+
+            if (99 === (int) $invoice->inv_cst_id) {
+                $I->assertNull($invoice->customer);
+            } else {
+                $I->assertInstanceOf(Customers::class, $invoice->customer);
+            }
+        }
+    }
+
+    /**
+     * Tests Phalcon\Mvc\Model\Manager :: eagerLoad() - with the query builder
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2021-07-07
+     *
+     * @group  mysql
+     * @group  pgsql
+     * @group  sqlite
+     */
+    public function mvcModelManagerEagerLoadBuilder(DatabaseTester $I)
+    {
+        $I->wantToTest('Mvc\Model\Manager - eagerLoad() - builder');
+
+        $builder = $this->container->get('modelsManager')
+            ->createBuilder()
+            ->from(Customers::class)
+            ->where('cst_id = 1')
+            ->with('invoices');
+
+        $I->assertEquals(['invoices'], $builder->getWith());
+
+        $customers = $builder->getQuery()->execute();
+
+        $I->getConnection()->exec('DELETE FROM co_invoices');
+
+        $I->assertCount(2, $customers->getFirst()->invoices);
+    }
+
+    /**
+     * Tests Phalcon\Mvc\Model\Manager :: eagerLoad() - unknown relation
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2021-07-07
+     *
+     * @group  mysql
+     * @group  pgsql
+     * @group  sqlite
+     */
+    public function mvcModelManagerEagerLoadUnknownRelation(DatabaseTester $I)
+    {
+        $I->wantToTest('Mvc\Model\Manager - eagerLoad() - unknown relation');
+
+        $I->expectThrowable(
+            new Exception(
+                "There is no defined relations for the model '" .
+                Customers::class . "' using alias 'unknown'"
+            ),
+            function () {
+                Customers::find(
+                    [
+                        'with' => 'unknown',
+                    ]
+                );
+            }
+        );
+    }
+}
@@ -0,0 +1,179 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the
+ * LICENSE.txt file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Test\Database\Mvc\Model\Manager;
+
+use DatabaseTester;
+use Phalcon\Cache;
+use Phalcon\Cache\AdapterFactory;
+use Phalcon\Mvc\Model\Manager;
+use Phalcon\Mvc\Model\Query;
+use Phalcon\Mvc\Model\Resultset\Simple;
+use Phalcon\Storage\Exception;
+use Phalcon\Storage\SerializerFactory;
+use Phalcon\Test\Fixtures\Traits\DiTrait;
+use Phalcon\Test\Models\Invoices;
+
+class PhqlCacheCest
+{
+    use DiTrait;
+
+    /**
+     * Executed before each test
+     *
+     * @param  DatabaseTester $I
+     * @return void
+     */
+    public function _before(DatabaseTester $I): void
+    {
+        try {
+            $this->setNewFactoryDefault();
+        } catch (Exception $e) {
+            $I->fail($e->getMessage());
+        }
+
+        $this->setDatabase($I);
+    }
+
+    /**
+     * Tests Phalcon\Mvc\Model\Manager :: setPhqlCache()
+     *
+     * @param  DatabaseTester $I
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2021-07-06
+     *
+     * @group  mysql
+     * @group  pgsql
+     * @group  sqlite
+     */
+    public function mvcModelManagerPhqlCache(DatabaseTester $I)
+    {
+        $I->wantToTest('Mvc\Model\Manager - setPhqlCache()');
+
+        $factory = new AdapterFactory(new SerializerFactory());
+        $cache   = new Cache($factory->newInstance('memory'));
+
+        /** @var Manager $manager */
+        $manager = $this->getService('modelsManager');
+
+        $I->assertNull(
+            $manager->getPhqlCache()
+        );
+
+        $manager->setPhqlCache($cache, 'v1');
+
+        $I->assertSame(
+            $cache,
+            $manager->getPhqlCache()
+        );
+
+        $sql = sprintf(
+            'SELECT * FROM [%s] WHERE inv_id > :id:',
+            Invoices::class
+        );
+
+        $I->assertInstanceOf(
+            Simple::class,
+            $manager->executeQuery($sql, ['id' => 0])
+        );
+
+        $I->assertEquals(
+            [
+                'hits'      => 0,
+                'misses'    => 1,
+                'writes'    => 1,
+                'evictions' => 0,
+            ],
+            $manager->getPhqlCacheStats()
+        );
+
+        /**
+         * A new request: the per request cache is empty
+         */
+        Query::clean();
+
+        $I->assertInstanceOf(
+            Simple::class,
+            $manager->executeQuery($sql, ['id' => 0])
+        );
+
+        $I->assertEquals(
+            [
+                'hits'      => 1,
+                'misses'    => 1,
+                'writes'    => 1,
+                'evictions' => 0,
+            ],
+            $manager->getPhqlCacheStats()
+        );
+
+        $cached = $manager->readPhqlCache($sql);
+
+        $I->assertEquals(
+            Query::TYPE_SELECT,
+            $cached['type']
+        );
+
+        $I->assertArrayHasKey('models', $cached['intermediate']);
+        $I->assertArrayHasKey(Invoices::class, $cached['metadata']);
+
+        /**
+         * Statements prepared with other metadata are evicted
+         */
+        $I->setProtectedProperty(
+            $manager,
+            'phqlCacheFingerprints',
+            [
+                Invoices::class => 'changed',
+            ]
+        );
+
+        $I->assertNull(
+            $manager->readPhqlCache($sql)
+        );
+
+        $I->assertEquals(
+            [
+                'hits'      => 2,
+                'misses'    => 2,
+                'writes'    => 1,
+                'evictions' => 1,
+            ],
+            $manager->getPhqlCacheStats()
+        );
+
+        $I->assertInstanceOf(
+            Simple::class,
+            $manager->executeQuery($sql, ['id' => 0])
+        );
+
+        $cached = $manager->readPhqlCache($sql);
+
+        $I->assertEquals(
+            [
+                Invoices::class => 'changed',
+            ],
+            $cached['metadata']
+        );
+
+        /**
+         * A different version does not reuse the statement
+         */
+        $manager->setPhqlCache($cache, 'v2');
+
+        $I->assertNull(
+            $manager->readPhqlCache($sql)
+        );
+    }
+}
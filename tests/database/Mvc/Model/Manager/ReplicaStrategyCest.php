@@ -0,0 +1,168 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the
+ * LICENSE.txt file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Test\Database\Mvc\Model\Manager;
+
+use DatabaseTester;
+use Phalcon\Db\Adapter\Pdo\Sqlite;
+use Phalcon\Db\ReplicaStrategy;
+use Phalcon\Mvc\Model\Manager;
+use Phalcon\Storage\Exception;
+use Phalcon\Test\Fixtures\Traits\DiTrait;
+use Phalcon\Test\Models\Invoices;
+
+use function getOptionsSqlite;
+use function outputDir;
+use function uniqid;
+
+class ReplicaStrategyCest
+{
+    use DiTrait;
+
+    /**
+     * Executed before each test
+     *
+     * @param  DatabaseTester $I
+     * @return void
+     */
+    public function _before(DatabaseTester $I): void
+    {
+        try {
+            $this->setNewFactoryDefault();
+        } catch (Exception $e) {
+            $I->fail($e->getMessage());
+        }
+
+        $this->setDatabase($I);
+
+        $missing = outputDir(uniqid('missing-') . '/replica.sqlite');
+
+        $this->container->setShared(
+            'dbDown',
+            function () use ($missing) {
+                return new Sqlite(['dbname' => $missing]);
+            }
+        );
+        $this->container->setShared(
+            'dbUp',
+            function () {
+                return new Sqlite(getOptionsSqlite());
+            }
+        );
+    }
+
+    /**
+     * Tests Phalcon\Mvc\Model\Manager :: setReplicaStrategy()
+     *
+     * @param  DatabaseTester $I
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2021-07-07
+     *
+     * @group  sqlite
+     */
+    public function mvcModelManagerReplicaStrategy(DatabaseTester $I)
+    {
+        $I->wantToTest('Mvc\Model\Manager - setReplicaStrategy()');
+
+        /** @var Manager $manager */
+        $manager  = $this->getService('modelsManager');
+        $strategy = new ReplicaStrategy(
+            [
+                'dbDown' => 1,
+                'dbUp'   => 1,
+            ]
+        );
+
+        $manager->setReplicaStrategy('db', $strategy);
+
+        $I->assertSame($strategy, $manager->getReplicaStrategy('db'));
+        $I->assertNull($manager->getReplicaStrategy('dbOther'));
+
+        $model = new Invoices();
+
+        /**
+         * The replica failing to connect is marked down and, with no replica
+         * left, the read connection service is used
+         */
+        $strategy->markDown('dbUp');
+
+        $I->assertSame(
+            $this->container->getShared('db'),
+            $manager->getReadConnection($model)
+        );
+        $I->assertTrue($strategy->isDown('dbDown'));
+
+        /**
+         * The replica down is never picked again
+         */
+        $strategy->markUp('dbUp');
+
+        for ($i = 0; $i < 10; $i++) {
+            $I->assertSame(
+                $this->container->getShared('dbUp'),
+                $manager->getReadConnection($model)
+            );
+        }
+
+        $I->assertFalse($strategy->isDown('dbUp'));
+    }
+
+    /**
+     * Tests Phalcon\Mvc\Model\Manager :: getWriteConnection() - sticky
+     *
+     * @param  DatabaseTester $I
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2021-07-07
+     *
+     * @group  sqlite
+     */
+    public function mvcModelManagerReplicaStrategySticky(DatabaseTester $I)
+    {
+        $I->wantToTest('Mvc\Model\Manager - getWriteConnection() - sticky');
+
+        /** @var Manager $manager */
+        $manager  = $this->getService('modelsManager');
+        $strategy = new ReplicaStrategy(
+            [
+                'dbUp' => 1,
+            ]
+        );
+        $strategy->setSticky(true);
+
+        $manager->setReplicaStrategy('db', $strategy);
+
+        $model = new Invoices();
+
+        $I->assertSame(
+            $this->container->getShared('dbUp'),
+            $manager->getReadConnection($model)
+        );
+        $I->assertNull($strategy->getLastWrite());
+
+        /**
+         * Reads after a write use the write connection
+         */
+        $I->assertSame(
+            $this->container->getShared('db'),
+            $manager->getWriteConnection($model)
+        );
+        $I->assertNotNull($strategy->getLastWrite());
+
+        $I->assertSame(
+            $this->container->getShared('db'),
+            $manager->getReadConnection($model)
+        );
+    }
+}
@@ -0,0 +1,152 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the
+ * LICENSE.txt file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Test\Database\Mvc\Model\Query;
+
+use DatabaseTester;
+use Phalcon\Mvc\Model\Query;
+use Phalcon\Storage\Exception;
+use Phalcon\Test\Fixtures\Migrations\InvoicesMigration;
+use Phalcon\Test\Fixtures\Traits\DiTrait;
+use Phalcon\Test\Models\Invoices;
+
+class SqlCacheCest
+{
+    use DiTrait;
+
+    /**
+     * @var InvoicesMigration
+     */
+    private $invoiceMigration;
+
+    /**
+     * Executed before each test
+     *
+     * @param DatabaseTester $I
+     *
+     * @return void
+     */
+    public function _before(DatabaseTester $I): void
+    {
+        try {
+            $this->setNewFactoryDefault();
+        } catch (Exception $e) {
+            $I->fail($e->getMessage());
+        }
+
+        $this->setDatabase($I);
+
+        $this->invoiceMigration = new InvoicesMigration($I->getConnection());
+    }
+
+    /**
+     * Tests Phalcon\Mvc\Model\Query :: execute() - SQL reused between
+     * executions
+     *
+     * @param DatabaseTester $I
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2021-07-07
+     *
+     * @group  mysql
+     * @group  pgsql
+     * @group  sqlite
+     */
+    public function mvcModelQuerySqlCache(DatabaseTester $I)
+    {
+        $I->wantToTest('Mvc\Model\Query - execute() - SQL cache');
+
+        $this->invoiceMigration->insert(1, 1, 1, 'one');
+        $this->invoiceMigration->insert(2, 1, 1, 'two');
+        $this->invoiceMigration->insert(3, 1, 1, 'three');
+
+        Query::clean();
+
+        $phql = sprintf(
+            'SELECT i.inv_id FROM [%s] AS i WHERE i.inv_id IN ({ids:array}) ORDER BY i.inv_id',
+            Invoices::class
+        );
+
+        $query = new Query($phql, $this->container);
+        $query->setBindParams(['ids' => [1, 2]]);
+        $first = $query->getSql();
+
+        $query = new Query($phql, $this->container);
+        $query->setBindParams(['ids' => [2, 3]]);
+        $second = $query->getSql();
+
+        $I->assertEquals($first['sql'], $second['sql']);
+
+        /**
+         * The number of array placeholders is part of the key
+         */
+        $query = new Query($phql, $this->container);
+        $query->setBindParams(['ids' => [1, 2, 3]]);
+
+        $I->assertNotEquals(
+            $first['sql'],
+            $query->getSql()['sql']
+        );
+
+        $I->assertCount(
+            3,
+            $query->execute()
+        );
+
+        $query = new Query($phql, $this->container);
+
+        $I->assertCount(
+            2,
+            $query->execute(['ids' => [1, 3]])
+        );
+    }
+
+    /**
+     * Tests Phalcon\Mvc\Model\Query :: execute() - SQL cache - models are
+     * loaded through the current container
+     *
+     * @param DatabaseTester $I
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2021-07-07
+     *
+     * @group  mysql
+     * @group  pgsql
+     * @group  sqlite
+     */
+    public function mvcModelQuerySqlCacheContainer(DatabaseTester $I)
+    {
+        $I->wantToTest('Mvc\Model\Query - execute() - SQL cache - container');
+
+        $this->invoiceMigration->insert(1, 1, 1, 'one');
+
+        Query::clean();
+
+        $phql = sprintf(
+            'SELECT * FROM [%s] WHERE inv_id = 1',
+            Invoices::class
+        );
+
+        $query = new Query($phql, $this->container);
+        $query->execute();
+
+        $this->setNewFactoryDefault();
+        $this->setDatabase($I);
+
+        $query  = new Query($phql, $this->container);
+        $record = $query->execute()->getFirst();
+
+        $I->assertInstanceOf(Invoices::class, $record);
+        $I->assertSame($this->container, $record->getDI());
+    }
+}
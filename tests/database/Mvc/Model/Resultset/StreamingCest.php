@@ -0,0 +1,154 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the
+ * LICENSE.txt file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Test\Database\Mvc\Model\Resultset;
+
+use DatabaseTester;
+use Phalcon\Mvc\Model\Exception;
+use Phalcon\Test\Fixtures\Migrations\InvoicesMigration;
+use Phalcon\Test\Fixtures\Traits\DiTrait;
+use Phalcon\Test\Models\Invoices;
+
+class StreamingCest
+{
+    use DiTrait;
+
+    /**
+     * Executed before each test
+     *
+     * @param  DatabaseTester $I
+     * @return void
+     */
+    public function _before(DatabaseTester $I): void
+    {
+        $this->setNewFactoryDefault();
+        $this->setDatabase($I);
+
+        $migration = new InvoicesMigration($I->getConnection());
+        $migration->clear();
+
+        for ($counter = 1; $counter <= 5; $counter++) {
+            $migration->insert($counter, 1, 1, 'title-' . $counter);
+        }
+    }
+
+    /**
+     * Tests Mvc\Model\Resultset :: isStreaming() - forward only iteration
+     *
+     * @param  DatabaseTester $I
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2021-07-07
+     *
+     * @group  mysql
+     * @group  pgsql
+     * @group  sqlite
+     */
+    public function mvcModelResultsetStreaming(DatabaseTester $I)
+    {
+        $I->wantToTest('Mvc\Model\Resultset - streaming');
+
+        $invoices = Invoices::find(
+            [
+                'order'  => 'inv_id',
+                'stream' => true,
+            ]
+        );
+
+        $I->assertTrue($invoices->isStreaming());
+
+        $ids = [];
+        foreach ($invoices as $invoice) {
+            $I->assertInstanceOf(Invoices::class, $invoice);
+            $ids[] = (int) $invoice->inv_id;
+        }
+
+        $I->assertEquals([1, 2, 3, 4, 5], $ids);
+        $I->assertCount(5, $invoices);
+
+        $I->expectThrowable(
+            new Exception('Streaming resultsets can only be traversed forward'),
+            function () use ($invoices) {
+                foreach ($invoices as $invoice) {
+                }
+            }
+        );
+
+        $I->expectThrowable(
+            new Exception(
+                'Streaming resultsets can not be converted to arrays, iterate them or use chunk() instead'
+            ),
+            function () {
+                Invoices::find(['stream' => true])->toArray();
+            }
+        );
+    }
+
+    /**
+     * Tests Mvc\Model\Resultset :: chunk()
+     *
+     * @param  DatabaseTester $I
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2021-07-07
+     *
+     * @group  mysql
+     * @group  pgsql
+     * @group  sqlite
+     */
+    public function mvcModelResultsetChunk(DatabaseTester $I)
+    {
+        $I->wantToTest('Mvc\Model\Resultset - chunk()');
+
+        foreach ([false, true] as $stream) {
+            $invoices = Invoices::find(
+                [
+                    'order'  => 'inv_id',
+                    'stream' => $stream,
+                ]
+            );
+
+            $chunks = [];
+            $actual = $invoices->chunk(
+                2,
+                function (array $records) use (&$chunks) {
+                    $chunks[] = array_map(
+                        function (Invoices $invoice) {
+                            return (int) $invoice->inv_id;
+                        },
+                        $records
+                    );
+                }
+            );
+
+            $I->assertTrue($actual);
+            $I->assertEquals([[1, 2], [3, 4], [5]], $chunks);
+        }
+
+        /**
+         * Returning false stops the iteration
+         */
+        $calls  = 0;
+        $actual = Invoices::find(['stream' => true])->chunk(
+            2,
+            function () use (&$calls) {
+                $calls++;
+
+                return false;
+            }
+        );
+
+        $I->assertFalse($actual);
+        $I->assertEquals(1, $calls);
+    }
+}
@@ -0,0 +1,122 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Test\Database\Mvc\Model;
+
+use DatabaseTester;
+use Phalcon\Events\Event;
+use Phalcon\Events\Manager as EventsManager;
+use Phalcon\Test\Fixtures\Migrations\InvoicesMigration;
+use Phalcon\Test\Fixtures\Traits\DiTrait;
+use Phalcon\Test\Models\Invoices;
+
+class SaveBatchCest
+{
+    use DiTrait;
+
+    public function _before(DatabaseTester $I)
+    {
+        $this->setNewFactoryDefault();
+        $this->setDatabase($I);
+
+        (new InvoicesMigration($I->getConnection()))->clear();
+    }
+
+    /**
+     * Tests Phalcon\Mvc\Model :: saveBatch() - arrays
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2021-07-07
+     *
+     * @group  mysql
+     * @group  pgsql
+     * @group  sqlite
+     */
+    public function mvcModelSaveBatchArrays(DatabaseTester $I)
+    {
+        $I->wantToTest('Mvc\Model - saveBatch() - arrays');
+
+        $records = [];
+        for ($counter = 1; $counter <= 300; $counter++) {
+            $records[] = [
+                'inv_cst_id'      => 1,
+                'inv_status_flag' => Invoices::STATUS_PAID,
+                'inv_title'       => 'title-' . $counter,
+            ];
+        }
+
+        $I->assertTrue(Invoices::saveBatch($records, false));
+        $I->assertEquals(300, Invoices::count());
+
+        $invoice = Invoices::findFirst(
+            [
+                'inv_title = :title:',
+                'bind' => [
+                    'title' => 'title-300',
+                ],
+            ]
+        );
+
+        $I->assertInstanceOf(Invoices::class, $invoice);
+        $I->assertGreaterThan(0, $invoice->inv_id);
+    }
+
+    /**
+     * Tests Phalcon\Mvc\Model :: saveBatch() - models and events
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2021-07-07
+     *
+     * @group  mysql
+     * @group  pgsql
+     * @group  sqlite
+     */
+    public function mvcModelSaveBatchModels(DatabaseTester $I)
+    {
+        $I->wantToTest('Mvc\Model - saveBatch() - models');
+
+        $fired         = [];
+        $eventsManager = new EventsManager();
+        $eventsManager->attach(
+            'model',
+            function (Event $event) use (&$fired) {
+                $fired[] = $event->getType();
+            }
+        );
+
+        $this->container->get('modelsManager')->setEventsManager($eventsManager);
+
+        $first            = new Invoices();
+        $first->inv_title = 'first';
+
+        $second            = new Invoices();
+        $second->inv_title = 'second';
+
+        $I->assertTrue(Invoices::saveBatch([$first, $second]));
+        $I->assertEquals(2, Invoices::count());
+
+        $I->assertEquals(
+            [
+                'beforeSave',
+                'beforeCreate',
+                'beforeSave',
+                'beforeCreate',
+                'afterCreate',
+                'afterSave',
+                'afterCreate',
+                'afterSave',
+            ],
+            $fired
+        );
+    }
+}
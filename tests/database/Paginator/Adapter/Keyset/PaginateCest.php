@@ -0,0 +1,169 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Test\Database\Paginator\Adapter\Keyset;
+
+use DatabaseTester;
+use Phalcon\Cache;
+use Phalcon\Cache\AdapterFactory;
+use Phalcon\Paginator\Adapter\Keyset;
+use Phalcon\Paginator\Exception;
+use Phalcon\Paginator\Repository;
+use Phalcon\Storage\SerializerFactory;
+use Phalcon\Test\Fixtures\Migrations\InvoicesMigration;
+use Phalcon\Test\Fixtures\Traits\DiTrait;
+use Phalcon\Test\Fixtures\Traits\RecordsTrait;
+use Phalcon\Test\Models\Invoices;
+
+class PaginateCest
+{
+    use DiTrait;
+    use RecordsTrait;
+
+    public function _before(DatabaseTester $I)
+    {
+        $this->setNewFactoryDefault();
+        $this->setDatabase($I);
+
+        /** @var PDO $connection */
+        $connection = $I->getConnection();
+        (new InvoicesMigration($connection));
+    }
+
+    /**
+     * Tests Phalcon\Paginator\Adapter\Keyset :: paginate()
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2021-07-07
+     *
+     * @group  mysql
+     * @group  sqlite
+     * @group  pgsql
+     */
+    public function paginatorAdapterKeysetPaginate(DatabaseTester $I)
+    {
+        $I->wantToTest('Paginator\Adapter\Keyset - paginate()');
+
+        /** @var PDO $connection */
+        $connection = $I->getConnection();
+        $migration  = new InvoicesMigration($connection);
+        $invId      = ('sqlite' === $I->getDriver()) ? 'null' : 'default';
+
+        $this->insertDataInvoices($migration, 12, $invId, 2, 'ccc');
+
+        $manager = $this->getService('modelsManager');
+        $builder = $manager
+            ->createBuilder()
+            ->from(Invoices::class)
+        ;
+
+        $factory = new AdapterFactory(new SerializerFactory());
+        $cache   = new Cache($factory->newInstance('memory'));
+        $config  = [
+            'builder' => $builder,
+            'keys'    => ['inv_id'],
+            'limit'   => 5,
+            'cache'   => $cache,
+        ];
+
+        /**
+         * First page
+         */
+        $page = (new Keyset($config))->paginate();
+
+        $I->assertInstanceOf(Repository::class, $page);
+        $I->assertCount(5, $page->getItems());
+        $I->assertEquals(12, $page->getTotalItems());
+        $I->assertNull($page->getPreviousCursor());
+        $I->assertNotNull($page->getNextCursor());
+
+        $first = $page->getItems()[0]->inv_id;
+
+        /**
+         * Second and last pages
+         */
+        $config['cursor'] = $page->getNextCursor();
+
+        $page = (new Keyset($config))->paginate();
+
+        $I->assertCount(5, $page->getItems());
+        $I->assertNotNull($page->getPreviousCursor());
+
+        $config['cursor'] = $page->getNextCursor();
+
+        $page = (new Keyset($config))->paginate();
+
+        $I->assertCount(2, $page->getItems());
+        $I->assertNull($page->getNextCursor());
+
+        /**
+         * Back to the first page
+         */
+        $config['cursor'] = $page->getPreviousCursor();
+
+        $page = (new Keyset($config))->paginate();
+
+        $config['cursor'] = $page->getPreviousCursor();
+
+        $page = (new Keyset($config))->paginate();
+
+        $I->assertCount(5, $page->getItems());
+        $I->assertEquals($first, $page->getItems()[0]->inv_id);
+        $I->assertNull($page->getPreviousCursor());
+
+        /**
+         * The total comes from the cache
+         */
+        $this->insertDataInvoices($migration, 1, $invId, 2, 'ddd');
+
+        $page = (new Keyset($config))->paginate();
+
+        $I->assertEquals(12, $page->getTotalItems());
+    }
+
+    /**
+     * Tests Phalcon\Paginator\Adapter\Keyset :: paginate() - invalid cursor
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2021-07-07
+     *
+     * @group  mysql
+     * @group  sqlite
+     * @group  pgsql
+     */
+    public function paginatorAdapterKeysetPaginateInvalidCursor(DatabaseTester $I)
+    {
+        $I->wantToTest('Paginator\Adapter\Keyset - paginate() - invalid cursor');
+
+        $I->expectThrowable(
+            new Exception('The cursor is not valid'),
+            function () {
+                $builder = $this->getService('modelsManager')
+                    ->createBuilder()
+                    ->from(Invoices::class)
+                ;
+
+                $paginator = new Keyset(
+                    [
+                        'builder' => $builder,
+                        'keys'    => ['inv_id'],
+                        'limit'   => 5,
+                        'cursor'  => 'not-a-cursor',
+                    ]
+                );
+
+                $paginator->paginate();
+            }
+        );
+    }
+}
@@ -48,9 +48,8 @@ class GetSetCest
         $target = outputDir() . 'ph-strm/te/st/-k/';
         $I->amInPath($target);
         $I->openFile('test-key');
-        $expected = 's:3:"ttl";i:3600;s:7:"content";s:25:"s:17:"Phalcon Framework";";}';
-
-        $I->seeInThisFile($expected);
+        $I->seeInThisFile('phss');
+        $I->seeInThisFile('s:17:"Phalcon Framework";');
         $I->safeDeleteFile($target . 'test-key');
     }
 
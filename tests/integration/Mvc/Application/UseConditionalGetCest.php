@@ -0,0 +1,102 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Test\Integration\Mvc\Application;
+
+use IntegrationTester;
+use Phalcon\Di\FactoryDefault;
+use Phalcon\Mvc\Application;
+use Phalcon\Mvc\Dispatcher;
+use Phalcon\Mvc\View;
+
+class UseConditionalGetCest
+{
+    /**
+     * @var array
+     */
+    private $server = [];
+
+    public function _before(IntegrationTester $I)
+    {
+        $this->server = $_SERVER;
+    }
+
+    public function _after(IntegrationTester $I)
+    {
+        $_SERVER = $this->server;
+    }
+
+    /**
+     * Tests Phalcon\Mvc\Application :: useConditionalGet()
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2021-07-07
+     */
+    public function mvcApplicationUseConditionalGet(IntegrationTester $I)
+    {
+        $I->wantToTest('Mvc\Application - useConditionalGet()');
+
+        $_SERVER['REQUEST_METHOD'] = 'GET';
+
+        $response = $this->getApplication()->handle('/micro');
+
+        $I->assertEquals('We are here', $response->getContent());
+
+        $etag = $response->getHeaders()->get('Etag');
+        $I->assertNotFalse($etag);
+
+        $_SERVER['HTTP_IF_NONE_MATCH'] = $etag;
+
+        $response = $this->getApplication()->handle('/micro');
+
+        $I->assertEquals(304, $response->getStatusCode());
+        $I->assertEquals('', $response->getContent());
+    }
+
+    private function getApplication(): Application
+    {
+        $di = new FactoryDefault();
+
+        $di->set(
+            'view',
+            function () {
+                $view = new View();
+
+                $view->setViewsDir(
+                    dataDir('fixtures/views/simple/')
+                );
+
+                return $view;
+            },
+            true
+        );
+
+        $di->set(
+            'dispatcher',
+            function () {
+                $dispatcher = new Dispatcher();
+                $dispatcher->setDefaultNamespace(
+                    'Phalcon\Test\Controllers'
+                );
+
+                return $dispatcher;
+            }
+        );
+
+        $application = new Application();
+        $application->setDI($di);
+        $application->useConditionalGet(true);
+
+        return $application;
+    }
+}
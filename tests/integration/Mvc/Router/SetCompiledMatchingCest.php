@@ -0,0 +1,206 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Test\Integration\Mvc\Router;
+
+use Codeception\Example;
+use IntegrationTester;
+use Phalcon\Mvc\Router;
+use Phalcon\Test\Fixtures\Traits\RouterTrait;
+
+class SetCompiledMatchingCest
+{
+    use RouterTrait;
+
+    /**
+     * Tests Phalcon\Mvc\Router :: setCompiledMatching()
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2021-07-05
+     */
+    public function mvcRouterSetCompiledMatching(IntegrationTester $I)
+    {
+        $I->wantToTest('Mvc\Router - setCompiledMatching()');
+
+        $router = $this->getRouter(false);
+
+        $I->assertFalse(
+            $router->isCompiledMatching()
+        );
+
+        $actual = $router->setCompiledMatching(true);
+
+        $I->assertInstanceOf(Router::class, $actual);
+
+        $I->assertTrue(
+            $router->isCompiledMatching()
+        );
+    }
+
+    /**
+     * Tests Phalcon\Mvc\Router :: setCompiledMatching() - same results as the
+     * linear scan
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2021-07-05
+     *
+     * @dataProvider getExamples
+     */
+    public function mvcRouterSetCompiledMatchingHandle(IntegrationTester $I, Example $example)
+    {
+        $I->wantToTest(
+            'Mvc\Router - setCompiledMatching() - ' . $example['method'] . ' ' . $example['uri']
+        );
+
+        $_SERVER['REQUEST_METHOD'] = $example['method'];
+
+        $linear   = $this->getCompiledTestRouter(false);
+        $compiled = $this->getCompiledTestRouter(true);
+
+        $linear->handle($example['uri']);
+        $compiled->handle($example['uri']);
+
+        $I->assertEquals(
+            $example['matched'],
+            $compiled->wasMatched()
+        );
+
+        $I->assertEquals(
+            $linear->wasMatched(),
+            $compiled->wasMatched()
+        );
+
+        if (!$example['matched']) {
+            return;
+        }
+
+        $I->assertEquals(
+            $example['controller'],
+            $compiled->getControllerName()
+        );
+
+        $I->assertEquals(
+            $linear->getActionName(),
+            $compiled->getActionName()
+        );
+
+        $I->assertEquals(
+            $linear->getParams(),
+            $compiled->getParams()
+        );
+
+        $I->assertEquals(
+            $linear->getMatches(),
+            $compiled->getMatches()
+        );
+    }
+
+    /**
+     * Tests Phalcon\Mvc\Router :: compile() - rebuilt when routes are added
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2021-07-05
+     */
+    public function mvcRouterCompileRebuild(IntegrationTester $I)
+    {
+        $I->wantToTest('Mvc\Router - compile() - rebuild');
+
+        $router = $this->getRouter(false);
+        $router->setCompiledMatching(true);
+
+        $router->add('/docs/{page}', 'docs::show');
+
+        $router->handle('/blog/latest');
+
+        $I->assertFalse(
+            $router->wasMatched()
+        );
+
+        $router->add('/blog/{slug}', 'blog::show');
+
+        $router->handle('/blog/latest');
+
+        $I->assertTrue(
+            $router->wasMatched()
+        );
+
+        $I->assertEquals(
+            'blog',
+            $router->getControllerName()
+        );
+
+        $compiled = $router->compile();
+
+        $I->assertArrayHasKey('blog', $compiled['dynamic']['*']);
+        $I->assertArrayHasKey('docs', $compiled['dynamic']['*']);
+    }
+
+    private function getCompiledTestRouter(bool $compiled): Router
+    {
+        $router = $this->getRouter(true);
+
+        $router->setCompiledMatching($compiled);
+
+        $router->add('/about', 'pages::about');
+        $router->addGet('/users', 'users::list');
+        $router->addPost('/users', 'users::create');
+        $router->addGet('/users/{id:[0-9]+}', 'users::get');
+        $router->addPut('/users/{id:[0-9]+}', 'users::update');
+        $router->add('/users/{id:[0-9]+}/posts/:params', 'posts::list');
+        $router->add('/blog/{year:[0-9]{4}}/{slug}', 'blog::show');
+        $router->add('/blog/(news|events)', 'blog::category');
+        $router->add('#^/legacy/([a-z]+)$#i', ['controller' => 'legacy', 'action' => 1]);
+
+        $router
+            ->add('/admin/:controller/:action', ['controller' => 1, 'action' => 2])
+            ->beforeMatch(
+                function ($uri) {
+                    return $uri !== '/admin/secret/show';
+                }
+            )
+        ;
+
+        $router
+            ->add('/products/{id}', 'products::show')
+            ->convert(
+                'action',
+                function () {
+                    return 'converted';
+                }
+            )
+        ;
+
+        return $router;
+    }
+
+    private function getExamples(): array
+    {
+        return [
+            ['method' => 'GET', 'uri' => '/about', 'matched' => true, 'controller' => 'pages'],
+            ['method' => 'GET', 'uri' => '/users', 'matched' => true, 'controller' => 'users'],
+            ['method' => 'POST', 'uri' => '/users', 'matched' => true, 'controller' => 'users'],
+            ['method' => 'GET', 'uri' => '/users/12', 'matched' => true, 'controller' => 'users'],
+            ['method' => 'PUT', 'uri' => '/users/12', 'matched' => true, 'controller' => 'users'],
+            ['method' => 'GET', 'uri' => '/users/12/posts/a/b', 'matched' => true, 'controller' => 'posts'],
+            ['method' => 'GET', 'uri' => '/blog/2021/release', 'matched' => true, 'controller' => 'blog'],
+            ['method' => 'GET', 'uri' => '/blog/events', 'matched' => true, 'controller' => 'blog'],
+            ['method' => 'GET', 'uri' => '/legacy/PAGE', 'matched' => true, 'controller' => 'legacy'],
+            ['method' => 'GET', 'uri' => '/admin/reports/show', 'matched' => true, 'controller' => 'reports'],
+            ['method' => 'GET', 'uri' => '/admin/secret/show', 'matched' => true, 'controller' => 'admin'],
+            ['method' => 'GET', 'uri' => '/products/10', 'matched' => true, 'controller' => 'products'],
+            ['method' => 'GET', 'uri' => '/session/start', 'matched' => true, 'controller' => 'session'],
+            ['method' => 'DELETE', 'uri' => '/users/12', 'matched' => true, 'controller' => 'users'],
+            ['method' => 'GET', 'uri' => '/', 'matched' => false, 'controller' => null],
+        ];
+    }
+}
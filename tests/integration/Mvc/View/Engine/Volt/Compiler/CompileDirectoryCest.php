@@ -0,0 +1,101 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Test\Integration\Mvc\View\Engine\Volt\Compiler;
+
+use IntegrationTester;
+use Phalcon\Mvc\View\Engine\Volt\Compiler;
+use Phalcon\Mvc\View\Engine\Volt\Exception;
+
+use function dataDir;
+use function outputDir;
+
+class CompileDirectoryCest
+{
+    /**
+     * Tests Phalcon\Mvc\View\Engine\Volt\Compiler :: compileDirectory()
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2021-07-07
+     */
+    public function mvcViewEngineVoltCompilerCompileDirectory(IntegrationTester $I)
+    {
+        $I->wantToTest('Mvc\View\Engine\Volt\Compiler - compileDirectory()');
+
+        $compiledPath = outputDir('tests/volt/');
+        if (!is_dir($compiledPath)) {
+            mkdir($compiledPath, 0777, true);
+        }
+
+        $volt = new Compiler();
+        $volt->setOptions(
+            [
+                'path' => $compiledPath,
+                'stat' => false,
+            ]
+        );
+
+        $compiled = $volt->compileDirectory(
+            dataDir('fixtures/views/filters/')
+        );
+
+        $I->assertCount(2, $compiled);
+
+        foreach ($compiled as $templatePath => $compiledTemplatePath) {
+            $I->assertStringEndsWith('.volt', $templatePath);
+            $I->assertStringStartsWith($compiledPath, $compiledTemplatePath);
+            $I->seeFileFound($compiledTemplatePath);
+        }
+
+        /**
+         * The "always" option used while compiling is not kept
+         */
+        $I->assertNull($volt->getOption('always'));
+
+        /**
+         * Compilations are renamed from temporary files
+         */
+        $I->assertEquals([], glob($compiledPath . '*.tmp'));
+
+        /**
+         * Lock files are removed once the templates are compiled
+         */
+        $I->assertEquals([], glob($compiledPath . '*.lock'));
+
+        foreach (glob($compiledPath . '*') as $file) {
+            $I->safeDeleteFile($file);
+        }
+    }
+
+    /**
+     * Tests Phalcon\Mvc\View\Engine\Volt\Compiler :: compileDirectory() -
+     * missing directory
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2021-07-07
+     */
+    public function mvcViewEngineVoltCompilerCompileDirectoryMissing(IntegrationTester $I)
+    {
+        $I->wantToTest('Mvc\View\Engine\Volt\Compiler - compileDirectory() - missing');
+
+        $directory = dataDir('fixtures/views/unknown/');
+
+        $I->expectThrowable(
+            new Exception('Directory ' . $directory . ' does not exist'),
+            function () use ($directory) {
+                $volt = new Compiler();
+                $volt->compileDirectory($directory);
+            }
+        );
+    }
+}
@@ -0,0 +1,91 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Test\Integration\Session\Adapter\Stream;
+
+use IntegrationTester;
+use Phalcon\Test\Fixtures\Traits\DiTrait;
+use SessionUpdateTimestampHandlerInterface;
+
+use function cacheDir;
+use function uniqid;
+
+class UpdateTimestampCest
+{
+    use DiTrait;
+
+    /**
+     * Tests Phalcon\Session\Adapter\Stream :: updateTimestamp()
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2021-07-07
+     */
+    public function sessionAdapterStreamUpdateTimestamp(IntegrationTester $I)
+    {
+        $I->wantToTest('Session\Adapter\Stream - updateTimestamp()');
+
+        $adapter = $this->newService('sessionStream');
+        $file    = cacheDir('sessions/test1');
+        $value   = uniqid();
+
+        $I->assertInstanceOf(
+            SessionUpdateTimestampHandlerInterface::class,
+            $adapter
+        );
+
+        $I->assertFalse(
+            $adapter->validateId('test1')
+        );
+
+        $I->assertTrue(
+            $adapter->write('test1', $value)
+        );
+
+        $I->assertTrue(
+            $adapter->validateId('test1')
+        );
+
+        touch($file, time() - 100);
+        clearstatcache();
+
+        $I->assertTrue(
+            $adapter->updateTimestamp('test1', $value)
+        );
+
+        clearstatcache();
+        $I->assertGreaterThan(time() - 100, filemtime($file));
+
+        /**
+         * Writing the data that was read only touches the file
+         */
+        $I->assertEquals(
+            $value,
+            $adapter->read('test1')
+        );
+
+        touch($file, time() - 100);
+        clearstatcache();
+
+        $I->assertTrue(
+            $adapter->write('test1', $value)
+        );
+
+        clearstatcache();
+        $I->assertGreaterThan(time() - 100, filemtime($file));
+
+        $I->amInPath(cacheDir('sessions'));
+        $I->seeFileFound('test1');
+        $I->seeInThisFile($value);
+        $I->safeDeleteFile($file);
+    }
+}
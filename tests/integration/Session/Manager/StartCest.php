@@ -0,0 +1,85 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Test\Integration\Session\Manager;
+
+use IntegrationTester;
+use Phalcon\Session\Manager;
+use Phalcon\Test\Fixtures\Traits\DiTrait;
+
+class StartCest
+{
+    use DiTrait;
+
+    /**
+     * Tests Phalcon\Session\Manager :: start() - lazy
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2021-07-07
+     */
+    public function sessionManagerStartLazy(IntegrationTester $I)
+    {
+        $I->wantToTest('Session\Manager - start() - lazy');
+
+        $manager = new Manager(
+            [
+                'lazy' => true,
+            ]
+        );
+
+        $manager->setAdapter(
+            $this->newService('sessionStream')
+        );
+
+        $I->assertTrue(
+            $manager->start()
+        );
+
+        /**
+         * Not opened until used
+         */
+        $I->assertFalse(
+            $manager->exists()
+        );
+
+        /**
+         * Reading without a session cookie does not open it
+         */
+        unset($_COOKIE[$manager->getName()]);
+
+        $I->assertFalse(
+            $manager->has('test')
+        );
+
+        $I->assertFalse(
+            $manager->exists()
+        );
+
+        $manager->set('test', 'myval');
+
+        $I->assertTrue(
+            $manager->exists()
+        );
+
+        $I->assertEquals(
+            'myval',
+            $manager->get('test')
+        );
+
+        $manager->destroy();
+
+        $I->assertFalse(
+            $manager->exists()
+        );
+    }
+}
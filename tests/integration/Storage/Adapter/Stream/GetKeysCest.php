@@ -17,6 +17,9 @@ use Phalcon\Storage\Adapter\Stream;
 use Phalcon\Storage\SerializerFactory;
 use IntegrationTester;
 
+use function file_put_contents;
+use function is_dir;
+use function mkdir;
 use function outputDir;
 use function sort;
 use function uniqid;
@@ -175,4 +178,56 @@ class GetKeysCest
 
         $I->safeDeleteDirectory(outputDir('pref-'));
     }
+
+    /**
+     * Tests Phalcon\Storage\Adapter\Stream :: getKeys() - temporary files
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2021-07-07
+     */
+    public function storageAdapterStreamGetKeysTemporaryFiles(IntegrationTester $I)
+    {
+        $I->wantToTest('Storage\Adapter\Stream - getKeys() - temporary files');
+
+        $serializer = new SerializerFactory();
+        $storageDir = outputDir('tests/stream/');
+
+        $adapter = new Stream(
+            $serializer,
+            [
+                'storageDir' => $storageDir,
+            ]
+        );
+
+        $I->assertTrue($adapter->clear());
+
+        $adapter->set('key', 'test');
+
+        /**
+         * A file being written by another set()
+         */
+        $temporaryDir = $storageDir . 'ph-strm-tmp/';
+        if (true !== is_dir($temporaryDir)) {
+            mkdir($temporaryDir, 0777, true);
+        }
+
+        $temporaryFile = $temporaryDir . uniqid('', true) . '.tmp';
+        $I->assertNotFalse(
+            file_put_contents($temporaryFile, 'test')
+        );
+
+        $expected = [
+            'ph-strmkey',
+        ];
+        $actual   = $adapter->getKeys();
+        $I->assertEquals($expected, $actual);
+
+        $I->assertTrue($adapter->clear());
+        $I->assertEmpty($adapter->getKeys());
+        $I->assertFileExists($temporaryFile);
+
+        $I->safeDeleteFile($temporaryFile);
+        $I->safeDeleteDirectory($storageDir . 'ph-strm');
+        $I->safeDeleteDirectory($temporaryDir);
+    }
 }
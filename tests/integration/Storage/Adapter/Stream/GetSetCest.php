@@ -55,9 +55,8 @@ class GetSetCest
         $target = $storageDir . 'ph-strm/te/st/-k/';
         $I->amInPath($target);
         $I->openFile('test-key');
-        $expected = 's:3:"ttl";i:3600;s:7:"content";s:25:"s:17:"Phalcon Framework";";}';
-
-        $I->seeInThisFile($expected);
+        $I->seeInThisFile('phss');
+        $I->seeInThisFile('s:17:"Phalcon Framework";');
         $I->safeDeleteFile($target . 'test-key');
     }
 
@@ -90,12 +89,59 @@ class GetSetCest
         $target = $storageDir . 'ph-strm/in/de/x-/12/32/13/21/-c/ac/';
         $I->amInPath($target);
         $I->openFile($filename);
-        $expected = 's:3:"ttl";i:30;s:7:"content";s:25:"s:17:"Phalcon Framework";";}';
-
-        $I->seeInThisFile($expected);
+        $I->seeInThisFile('phss');
+        $I->seeInThisFile('s:17:"Phalcon Framework";');
         $I->safeDeleteFile($target . $filename);
     }
 
+    /**
+     * Tests Phalcon\Storage\Adapter\Stream :: set() - header
+     *
+     * @throws Exception
+     * @since  2021-07-07
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     */
+    public function storageAdapterStreamSetHeader(IntegrationTester $I)
+    {
+        $I->wantToTest('Storage\Adapter\Stream - set() - header');
+
+        $serializer = new SerializerFactory();
+        $storageDir = outputDir() . 'tests/stream/';
+        $adapter    = new Stream(
+            $serializer,
+            [
+                'storageDir' => $storageDir,
+            ]
+        );
+
+        $start = time();
+        $I->assertTrue(
+            $adapter->set('test-key', 'Phalcon Framework', 30)
+        );
+
+        $target   = $storageDir . 'ph-strm/te/st/-k/';
+        $contents = file_get_contents($target . 'test-key');
+        $header   = unpack('a3magic/aformat/Jexpires', $contents);
+
+        $I->assertEquals('phs', $header['magic']);
+        $I->assertEquals('s', $header['format']);
+        $I->assertGreaterThanOrEqual($start + 30, $header['expires']);
+        $I->assertLessThanOrEqual(time() + 30, $header['expires']);
+
+        $expected = 's:17:"Phalcon Framework";';
+        $actual   = substr($contents, 12);
+        $I->assertEquals($expected, $actual);
+
+        /**
+         * No temporary files are left behind
+         */
+        $I->assertEquals([], glob($target . '*.tmp'));
+        $I->assertEquals([], glob($storageDir . 'ph-strm-tmp/*.tmp'));
+
+        $I->safeDeleteFile($target . 'test-key');
+    }
+
     /**
      * Tests Phalcon\Storage\Adapter\Stream :: get()
      *
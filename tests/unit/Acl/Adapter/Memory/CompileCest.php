@@ -0,0 +1,133 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Test\Unit\Acl\Adapter\Memory;
+
+use Phalcon\Acl\Adapter\Memory;
+use Phalcon\Acl\Component;
+use Phalcon\Acl\Enum;
+use Phalcon\Acl\Exception;
+use Phalcon\Acl\Role;
+use UnitTester;
+
+class CompileCest
+{
+    /**
+     * Tests Phalcon\Acl\Adapter\Memory :: compile()
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2021-07-07
+     */
+    public function aclAdapterMemoryCompile(UnitTester $I)
+    {
+        $I->wantToTest('Acl\Adapter\Memory - compile()');
+
+        $acl = $this->getAcl();
+        $acl->compile();
+
+        $I->assertTrue($acl->isAllowed('administrator', 'folder', 'list'));
+        $I->assertEquals('guest!folder!list', $acl->getActiveKey());
+        $I->assertTrue($acl->isAllowed('administrator', 'folder', 'add'));
+        $I->assertFalse($acl->isAllowed('administrator', 'folder', 'delete'));
+        $I->assertTrue($acl->isAllowed('administrator', 'reports', 'view'));
+        $I->assertFalse($acl->isAllowed('guest', 'folder', 'add'));
+
+        /**
+         * Changing the rules discards the compiled decisions
+         */
+        $acl->deny('administrator', 'folder', 'list');
+        $I->assertFalse($acl->isAllowed('administrator', 'folder', 'list'));
+
+        $acl->addRole(new Role('owner'), 'administrator');
+        $acl->allow('guest', 'folder', 'delete');
+        $I->assertTrue($acl->isAllowed('owner', 'folder', 'delete'));
+    }
+
+    /**
+     * Tests Phalcon\Acl\Adapter\Memory :: export()/import()
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2021-07-07
+     */
+    public function aclAdapterMemoryExportImport(UnitTester $I)
+    {
+        $I->wantToTest('Acl\Adapter\Memory - export()/import()');
+
+        $data = $this->getAcl()->export();
+
+        /**
+         * The exported list can be written in a PHP file
+         */
+        $data = eval('return ' . var_export($data, true) . ';');
+
+        $acl = new Memory();
+        $acl->import($data);
+
+        $I->assertTrue($acl->isRole('administrator'));
+        $I->assertTrue($acl->isComponent('folder'));
+        $I->assertCount(2, $acl->getRoles());
+        $I->assertEquals('administrator', $acl->getRoles()[1]->getName());
+
+        $I->assertTrue($acl->isAllowed('administrator', 'folder', 'list'));
+        $I->assertTrue($acl->isAllowed('administrator', 'folder', 'add'));
+        $I->assertFalse($acl->isAllowed('administrator', 'folder', 'delete'));
+        $I->assertTrue($acl->isAllowed('administrator', 'reports', 'view'));
+        $I->assertFalse($acl->isAllowed('guest', 'folder', 'add'));
+    }
+
+    /**
+     * Tests Phalcon\Acl\Adapter\Memory :: export() - functions
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2021-07-07
+     */
+    public function aclAdapterMemoryExportFunctions(UnitTester $I)
+    {
+        $I->wantToTest('Acl\Adapter\Memory - export() - functions');
+
+        $I->expectThrowable(
+            new Exception('Access lists with functions cannot be exported'),
+            function () {
+                $acl = $this->getAcl();
+                $acl->allow(
+                    'guest',
+                    'folder',
+                    'add',
+                    function () {
+                        return true;
+                    }
+                );
+
+                $acl->export();
+            }
+        );
+    }
+
+    private function getAcl(): Memory
+    {
+        $acl = new Memory();
+        $acl->setDefaultAction(Enum::DENY);
+
+        $acl->addRole(new Role('guest'));
+        $acl->addRole(new Role('administrator'), 'guest');
+
+        $acl->addComponent(new Component('folder'), ['list', 'add', 'delete']);
+        $acl->addComponent(new Component('reports'), ['view']);
+
+        $acl->allow('guest', 'folder', 'list');
+        $acl->allow('administrator', 'folder', 'add');
+        $acl->allow('administrator', 'reports', '*');
+
+        return $acl;
+    }
+}
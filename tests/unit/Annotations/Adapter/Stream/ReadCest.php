@@ -19,7 +19,9 @@ use TestClass;
 use UnitTester;
 
 use function dataDir;
+use function file_put_contents;
 use function outputDir;
+use function serialize;
 
 class ReadCest
 {
@@ -61,4 +63,37 @@ class ReadCest
         $I->safeDeleteFile('testwrite.php');
         $I->safeDeleteFile('testclass.php');
     }
+
+    /**
+     * Tests Phalcon\Annotations\Adapter\Stream :: read() - serialized file
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2021-07-07
+     */
+    public function annotationsAdapterStreamReadSerialized(UnitTester $I)
+    {
+        $I->wantToTest('Annotations\Adapter\Stream - read() - serialized file');
+
+        $adapter = new Stream(
+            [
+                'annotationsDir' => outputDir('tests/annotations/'),
+            ]
+        );
+
+        /**
+         * A file written in the previous format is a cache miss
+         */
+        $I->assertNotFalse(
+            file_put_contents(
+                outputDir('tests/annotations/testserialized.php'),
+                serialize(new Reflection([]))
+            )
+        );
+
+        $I->assertFalse(
+            $adapter->read('testserialized')
+        );
+
+        $I->safeDeleteFile(outputDir('tests/annotations/testserialized.php'));
+    }
 }
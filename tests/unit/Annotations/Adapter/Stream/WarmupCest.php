@@ -0,0 +1,86 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Test\Unit\Annotations\Adapter\Stream;
+
+use Phalcon\Annotations\Adapter\Stream;
+use Phalcon\Annotations\Reflection;
+use Phalcon\Test\Fixtures\Annotations\Warmup\WarmupClass;
+use UnitTester;
+
+use function dataDir;
+use function file_put_contents;
+use function outputDir;
+
+class WarmupCest
+{
+    /**
+     * Tests Phalcon\Annotations\Adapter\Stream :: warmup()
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2021-07-07
+     */
+    public function annotationsAdapterStreamWarmup(UnitTester $I)
+    {
+        $I->wantToTest('Annotations\Adapter\Stream - warmup()');
+
+        $adapter = new Stream(
+            [
+                'annotationsDir' => outputDir('tests/annotations/'),
+            ]
+        );
+
+        $fileName = outputDir(
+            'tests/annotations/phalcon_test_fixtures_annotations_warmup_warmupclass.php'
+        );
+
+        /**
+         * Stale annotations are refreshed
+         */
+        $I->assertNotFalse(
+            file_put_contents($fileName, '<?php return [];')
+        );
+
+        /**
+         * Files which are not classes, as routes.php, are not executed
+         */
+        $expected = [WarmupClass::class];
+        $actual   = $adapter->warmup(
+            dataDir('fixtures/Annotations/Warmup/')
+        );
+        $I->assertEquals($expected, $actual);
+
+        $I->assertFileExists($fileName);
+
+        /**
+         * The file returns the parsed annotations as an array
+         */
+        $data = require $fileName;
+        $I->assertIsArray($data);
+        $I->assertArrayHasKey('class', $data);
+
+        $adapter = new Stream(
+            [
+                'annotationsDir' => outputDir('tests/annotations/'),
+            ]
+        );
+
+        $reflection = $adapter->read(WarmupClass::class);
+        $I->assertInstanceOf(Reflection::class, $reflection);
+
+        $annotations = $reflection->getClassAnnotations();
+        $I->assertTrue($annotations->has('RoutePrefix'));
+
+        $I->safeDeleteFile($fileName);
+    }
+}
@@ -0,0 +1,158 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Test\Unit\Assets\Manager;
+
+use Phalcon\Assets\Exception;
+use Phalcon\Assets\Filters\Jsmin;
+use Phalcon\Assets\Manager;
+use Phalcon\Test\Fixtures\Traits\DiTrait;
+use UnitTester;
+
+use function basename;
+use function dataDir;
+use function glob;
+use function gzdecode;
+use function outputDir;
+use function uniqid;
+
+use const PHP_EOL;
+
+class BuildCest
+{
+    use DiTrait;
+
+    public function _before(UnitTester $I)
+    {
+        $this->newDi();
+        $this->setDiService('escaper');
+        $this->setDiService('url');
+    }
+
+    public function _after(UnitTester $I)
+    {
+        $this->resetDi();
+    }
+
+    /**
+     * Tests Phalcon\Assets\Manager :: build()
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2021-07-07
+     */
+    public function assetsManagerBuild(UnitTester $I)
+    {
+        $I->wantToTest('Assets\Manager - build()');
+
+        $name     = uniqid('app-');
+        $manifest = outputDir('tests/assets/' . $name . '.php');
+        $options  = [
+            'manifest'       => $manifest,
+            'targetBasePath' => outputDir('tests/assets/'),
+        ];
+
+        $assets = new Manager($options);
+        $assets->useImplicitOutput(false);
+        $this->addCollection($assets, $name);
+
+        $uri = $assets->build($assets->get('js'), 'js');
+        $I->assertRegExp('#^js/' . $name . '\.[0-9a-f]{8}\.js$#', $uri);
+
+        $bundle = outputDir('tests/assets/' . basename($uri));
+        $I->seeFileFound($bundle);
+        $I->seeFileFound($bundle . '.gz');
+        $I->seeFileFound($manifest);
+
+        $built = require $manifest;
+        $I->assertEquals($uri, $built['js/' . $name . '.js']['js']['uri']);
+        $I->assertArrayNotHasKey('css', $built['js/' . $name . '.js']);
+
+        /**
+         * A bundle of another type is not used for the collection
+         */
+        $assets = new Manager($options);
+        $assets->useImplicitOutput(false);
+        $this->addCollection($assets, $name);
+
+        $I->assertStringNotContainsString(
+            $uri,
+            (string) $assets->outputCss('js')
+        );
+
+        $I->assertEquals(
+            file_get_contents($bundle),
+            gzdecode(file_get_contents($bundle . '.gz'))
+        );
+
+        /**
+         * The tag is resolved from the manifest, on another request
+         */
+        $assets = new Manager($options);
+        $assets->useImplicitOutput(false);
+        $this->addCollection($assets, $name);
+
+        $I->assertEquals(
+            '<script src="//phalcon.io/' . $uri . '"></script>' . PHP_EOL,
+            $assets->outputJs('js')
+        );
+
+        /**
+         * Building again unchanged sources gives the same bundle
+         */
+        $I->assertEquals($uri, $assets->build($assets->get('js'), 'js'));
+
+        $I->safeDeleteFile($bundle);
+        $I->safeDeleteFile($bundle . '.gz');
+        $I->safeDeleteFile($manifest);
+
+        foreach (glob(outputDir('tests/assets/cache/*.js')) as $file) {
+            $I->safeDeleteFile($file);
+        }
+    }
+
+    /**
+     * Tests Phalcon\Assets\Manager :: build() - no manifest
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2021-07-07
+     */
+    public function assetsManagerBuildNoManifest(UnitTester $I)
+    {
+        $I->wantToTest('Assets\Manager - build() - no manifest');
+
+        $I->expectThrowable(
+            new Exception(
+                "The 'manifest' option is required to build a collection"
+            ),
+            function () {
+                $assets = new Manager();
+                $this->addCollection($assets, 'app');
+
+                $assets->build($assets->get('js'), 'js');
+            }
+        );
+    }
+
+    private function addCollection(Manager $assets, string $name): void
+    {
+        $assets->collection('js')
+               ->addJs(dataDir('assets/assets/jquery.js'))
+               ->join(true)
+               ->addFilter(new Jsmin())
+               ->setTargetPath($name . '.js')
+               ->setTargetLocal(false)
+               ->setPrefix('//phalcon.io/')
+               ->setTargetUri('js/' . $name . '.js')
+        ;
+    }
+}
@@ -0,0 +1,112 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Test\Unit\Config\Config;
+
+use Phalcon\Config;
+use Phalcon\Config\Adapter\Compiled;
+use Phalcon\Config\Exception;
+use Phalcon\Config\Frozen;
+use UnitTester;
+
+use function outputDir;
+use function uniqid;
+
+class CompileCest
+{
+    /**
+     * Tests Phalcon\Config :: compile()
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2021-07-07
+     */
+    public function configCompile(UnitTester $I)
+    {
+        $I->wantToTest('Config - compile()');
+
+        $file   = outputDir(uniqid('config-') . '.php');
+        $config = new Config(
+            [
+                'database' => [
+                    'adapter'  => 'Mysql',
+                    'replicas' => [
+                        ['host' => 'replica-1'],
+                        ['host' => 'replica-2'],
+                    ],
+                ],
+                'debug'    => false,
+            ]
+        );
+
+        $frozen = $config->compile($file);
+
+        $I->assertInstanceOf(Frozen::class, $frozen);
+        $I->seeFileFound($file);
+
+        $compiled = new Compiled($file);
+
+        $I->assertEquals($config->toArray(), $compiled->toArray());
+        $I->assertEquals(
+            'replica-2',
+            $compiled->path('database.replicas.1.host')
+        );
+        $I->assertEquals(
+            'replica-1',
+            $compiled->path('database/replicas/0/host', null, '/')
+        );
+        $I->assertEquals('Mysql', $compiled->path('DATABASE.ADAPTER'));
+        $I->assertFalse($compiled->path('debug', true));
+        $I->assertEquals('none', $compiled->path('database.unknown', 'none'));
+
+        /**
+         * Only the values are indexed, nested arrays are marked
+         */
+        $paths = $compiled->getPaths();
+
+        $I->assertSame([], $paths['database']);
+        $I->assertSame([], $paths['database.replicas']);
+        $I->assertSame('replica-1', $paths['database.replicas.0.host']);
+
+        $replica = $compiled->path('database.replicas.1');
+
+        $I->assertInstanceOf(Frozen::class, $replica);
+        $I->assertEquals('replica-2', $replica->host);
+        $I->assertSame($replica, $compiled->path('database.replicas.1'));
+
+        /**
+         * Nested nodes are frozen and reused
+         */
+        $database = $compiled->database;
+
+        $I->assertInstanceOf(Frozen::class, $database);
+        $I->assertSame($database, $compiled->get('database'));
+        $I->assertSame($database, $compiled->path('database'));
+        $I->assertEquals('Mysql', $database->adapter);
+
+        $I->expectThrowable(
+            new Exception('The configuration is read only'),
+            function () use ($compiled) {
+                $compiled->set('debug', true);
+            }
+        );
+
+        $I->expectThrowable(
+            new Exception('The configuration is read only'),
+            function () use ($compiled) {
+                $compiled->merge(['debug' => true]);
+            }
+        );
+
+        $I->safeDeleteFile($file);
+    }
+}
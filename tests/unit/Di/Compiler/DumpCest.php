@@ -0,0 +1,142 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Test\Unit\Di\Compiler;
+
+use InjectableComponent;
+use Phalcon\Di;
+use Phalcon\Di\Compiled;
+use Phalcon\Di\Compiler;
+use Phalcon\Di\Service;
+use Phalcon\Escaper;
+use Phalcon\Http\Response;
+use SomeServiceProvider;
+use UnitTester;
+
+use function dataDir;
+use function outputDir;
+use function uniqid;
+
+class DumpCest
+{
+    public function _before(UnitTester $I)
+    {
+        require_once dataDir('fixtures/Di/InjectableComponent.php');
+        require_once dataDir('fixtures/Di/SomeServiceProvider.php');
+
+        Di::reset();
+    }
+
+    /**
+     * Tests Phalcon\Di\Compiler :: dump()
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2021-07-07
+     */
+    public function diCompilerDump(UnitTester $I)
+    {
+        $I->wantToTest('Di\Compiler - dump()');
+
+        $className = 'Phalcon\Test\Compiled\Container' . uniqid();
+        $file      = outputDir(uniqid('container-') . '.php');
+
+        $container = new Di();
+        $container->register(new SomeServiceProvider());
+        $container->set('escaper', Escaper::class);
+        $container->setShared('response', Response::class);
+        $container->set('alias', 'response');
+        $container->set(
+            'component',
+            [
+                'className'  => InjectableComponent::class,
+                'arguments'  => [
+                    [
+                        'type' => 'service',
+                        'name' => 'response',
+                    ],
+                ],
+                'calls'      => [
+                    [
+                        'method'    => 'setResponse',
+                        'arguments' => [
+                            [
+                                'type' => 'service',
+                                'name' => 'alias',
+                            ],
+                        ],
+                    ],
+                ],
+                'properties' => [
+                    [
+                        'name'  => 'other',
+                        'value' => [
+                            'type'  => 'parameter',
+                            'value' => 'phalcon',
+                        ],
+                    ],
+                ],
+            ]
+        );
+
+        $compiler = new Compiler();
+        $compiler->dump($container, $className, $file);
+
+        $I->seeFileFound($file);
+        $I->assertEquals(['foo', 'fooAction'], $compiler->getSkippedServices());
+
+        require $file;
+
+        /** @var Compiled $compiled */
+        $compiled = new $className();
+
+        $I->assertInstanceOf(Compiled::class, $compiled);
+        $I->assertTrue($compiled->has('escaper'));
+        $I->assertFalse($compiled->has('foo'));
+
+        $I->assertInstanceOf(Escaper::class, $compiled->get('escaper'));
+        $I->assertNotSame($compiled->get('escaper'), $compiled->get('escaper'));
+
+        $response = $compiled->get('response');
+
+        $I->assertSame($response, $compiled->getResponse());
+        $I->assertSame($response, $compiled->get('alias'));
+
+        $component = $compiled->get('component');
+
+        $I->assertInstanceOf(InjectableComponent::class, $component);
+        $I->assertSame($response, $component->getResponse());
+        $I->assertEquals('phalcon', $component->other);
+        $I->assertSame($compiled, $component->getDI());
+
+        /**
+         * Services set at runtime take precedence
+         */
+        $compiled->set('escaper', Response::class);
+
+        $I->assertInstanceOf(Response::class, $compiled->get('escaper'));
+
+        $service = $compiled->getService('component');
+
+        $I->assertInstanceOf(Service::class, $service);
+        $I->assertEquals(
+            InjectableComponent::class,
+            $compiled->getRaw('component')['className']
+        );
+
+        $compiled->remove('alias');
+
+        $I->assertFalse($compiled->has('alias'));
+
+        $I->safeDeleteFile($file);
+    }
+}
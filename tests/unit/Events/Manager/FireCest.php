@@ -13,6 +13,10 @@ declare(strict_types=1);
 
 namespace Phalcon\Test\Unit\Events\Manager;
 
+use Phalcon\Events\Event;
+use Phalcon\Events\Exception;
+use Phalcon\Events\Manager;
+use stdClass;
 use UnitTester;
 
 class FireCest
@@ -27,6 +31,100 @@ class FireCest
     {
         $I->wantToTest('Events\Manager - fire()');
 
-        $I->skipTest('Need implementation');
+        $manager = new Manager();
+        $manager->enablePriorities(true);
+        $manager->collectResponses(true);
+
+        $manager->attach(
+            'some-type',
+            function (Event $event) {
+                return 'low';
+            },
+            10
+        );
+
+        $manager->attach(
+            'some-type:beforeSome',
+            function (Event $event) {
+                return 'exact';
+            }
+        );
+
+        $manager->attach(
+            'some-type',
+            function (Event $event) {
+                return 'high';
+            },
+            200
+        );
+
+        $actual = $manager->fire('some-type:beforeSome', new stdClass());
+        $I->assertEquals('exact', $actual);
+
+        $expected = ['high', 'low', 'exact'];
+        $actual   = $manager->getResponses();
+        $I->assertEquals($expected, $actual);
+
+        /**
+         * The sorted listeners are rebuilt after attaching
+         */
+        $manager->attach(
+            'some-type',
+            function (Event $event) {
+                return 'highest';
+            },
+            300
+        );
+
+        $manager->fire('some-type:beforeSome', new stdClass());
+
+        $expected = ['highest', 'high', 'low', 'exact'];
+        $actual   = $manager->getResponses();
+        $I->assertEquals($expected, $actual);
+
+        /**
+         * ...and after detaching
+         */
+        $manager->detachAll('some-type');
+
+        $manager->fire('some-type:beforeSome', new stdClass());
+
+        $expected = ['exact'];
+        $actual   = $manager->getResponses();
+        $I->assertEquals($expected, $actual);
+    }
+
+    /**
+     * Tests Phalcon\Events\Manager :: fire() - without listeners
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2021-07-07
+     */
+    public function eventsManagerFireWithoutListeners(UnitTester $I)
+    {
+        $I->wantToTest('Events\Manager - fire() - without listeners');
+
+        $manager = new Manager();
+        $manager->collectResponses(true);
+
+        $manager->attach(
+            'other-type',
+            function (Event $event) {
+                return 'other';
+            }
+        );
+
+        $actual = $manager->fire('some-type:beforeSome', new stdClass());
+        $I->assertNull($actual);
+
+        $actual = $manager->getResponses();
+        $I->assertEquals([], $actual);
+
+        $I->expectThrowable(
+            new Exception('Invalid event type some-type'),
+            function () use ($manager) {
+                $manager->fire('some-type', new stdClass());
+            }
+        );
     }
 }
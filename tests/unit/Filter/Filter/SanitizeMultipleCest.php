@@ -57,6 +57,42 @@ class SanitizeMultipleCest
         $I->assertEquals($expected, $actual);
     }
 
+    /**
+     * Tests sanitizing array with filters processing the whole array
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2021-07-07
+     */
+    public function filterFilterSanitizeArrayAtOnce(UnitTester $I)
+    {
+        $locator = new FilterFactory();
+        $filter  = $locator->newInstance();
+
+        $value    = ['a' => 'ab-c1', 'b' => 'abc', 'c' => 12, 'd' => null];
+        $expected = ['a' => 'abc1', 'b' => 'abc', 'c' => '12', 'd' => ''];
+        $actual   = $filter->sanitize($value, 'alnum');
+        $I->assertEquals($expected, $actual);
+
+        $value    = ['mary had', 'a little lamb'];
+        $expected = ['-had', 'a-little-lamb'];
+        $actual   = $filter->sanitize(
+            $value,
+            [
+                'replace' => [' ', '-'],
+                'remove'  => ['mary'],
+            ]
+        );
+        $I->assertEquals($expected, $actual);
+
+        /**
+         * Nested arrays are sanitized one value at a time
+         */
+        $value    = ['ab-c', ['d-e']];
+        $expected = ['abc', ['de']];
+        $actual   = $filter->sanitize($value, 'alpha');
+        $I->assertEquals($expected, $actual);
+    }
+
     /**
      * Tests sanitizing array with multiple filters
      *
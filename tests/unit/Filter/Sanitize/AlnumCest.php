@@ -43,6 +43,9 @@ class AlnumCest
             ['0', 0],
             ['', null],
             ['?a&5xka\tŧ?1-s.Xa[\n', 'a5xkat1sXan'],
+            ['Phalcon5', 'Phalcon5'],
+            ["a\0b\xff9\tc", 'ab9c'],
+            ['!?-', ''],
         ];
     }
 }
@@ -43,6 +43,9 @@ class AlphaCest
             ['0', ''],
             ['', null],
             ['a5@xkat1s!Xan', 'axkatsXan'],
+            ['Phalcon', 'Phalcon'],
+            ["a\0b\xff9\tc", 'abc'],
+            ['!?5', ''],
         ];
     }
 }
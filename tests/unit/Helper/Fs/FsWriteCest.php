@@ -0,0 +1,46 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Test\Unit\Helper\Fs;
+
+use Phalcon\Helper\Fs;
+use UnitTester;
+
+use function glob;
+use function outputDir;
+use function uniqid;
+
+class FsWriteCest
+{
+    /**
+     * Tests Phalcon\Helper\Fs :: write()
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2021-07-07
+     */
+    public function helperFsWrite(UnitTester $I)
+    {
+        $I->wantToTest('Helper\Fs - write()');
+
+        $file = outputDir(uniqid('fs-') . '.php');
+
+        $I->assertTrue(Fs::write($file, '<?php return 1;'));
+        $I->assertTrue(Fs::write($file, '<?php return 2;'));
+
+        $I->openFile($file);
+        $I->seeFileContentsEqual('<?php return 2;');
+        $I->assertEmpty(glob($file . '.*.tmp'));
+
+        $I->safeDeleteFile($file);
+    }
+}
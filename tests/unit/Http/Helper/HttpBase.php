@@ -63,6 +63,34 @@ class HttpBase
         return $container->get('response');
     }
 
+    /**
+     * Sends a response and returns its output, split in the chunks flushed
+     * from the output buffer
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2021-07-07
+     */
+    protected function getSentChunks(Response $response): array
+    {
+        $chunks = [];
+
+        ob_start(
+            function (string $buffer) use (&$chunks) {
+                if ('' !== $buffer) {
+                    $chunks[] = $buffer;
+                }
+
+                return '';
+            }
+        );
+
+        $response->send();
+
+        ob_end_flush();
+
+        return $chunks;
+    }
+
     /**
      * Checks the has functions on non defined variables
      *
@@ -48,4 +48,39 @@ class GetHeadersCest
 
         $_SERVER = $store;
     }
+
+    /**
+     * Tests Phalcon\Http\Request :: getHeaders() - server array changed
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2021-07-07
+     */
+    public function httpRequestGetHeadersServerChanged(UnitTester $I)
+    {
+        $I->wantToTest('Http\Request - getHeaders() - server array changed');
+
+        $store   = $_SERVER ?? [];
+        $_SERVER = [
+            'HTTP_FOO'    => 'Bar',
+            'HTTP_ACCEPT' => 'text/html;q=0.8,application/json',
+        ];
+
+        $request = new Request();
+
+        $I->assertEquals(['Foo' => 'Bar', 'Accept' => 'text/html;q=0.8,application/json'], $request->getHeaders());
+        $I->assertEquals(['Foo' => 'Bar', 'Accept' => 'text/html;q=0.8,application/json'], $request->getHeaders());
+        $I->assertEquals('application/json', $request->getBestAccept());
+
+        /**
+         * The cached values are rebuilt when the server array changes
+         */
+        $_SERVER['HTTP_FOO']    = 'Baz';
+        $_SERVER['HTTP_ACCEPT'] = 'text/html,application/json;q=0.5';
+
+        $I->assertEquals('Baz', $request->getHeaders()['Foo']);
+        $I->assertEquals('Baz', $request->getHeader('Foo'));
+        $I->assertEquals('text/html', $request->getBestAccept());
+
+        $_SERVER = $store;
+    }
 }
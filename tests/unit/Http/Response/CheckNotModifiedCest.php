@@ -0,0 +1,91 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Test\Unit\Http\Response;
+
+use DateTime;
+use Phalcon\Test\Unit\Http\Helper\HttpBase;
+use UnitTester;
+
+use function sha1;
+
+class CheckNotModifiedCest extends HttpBase
+{
+    /**
+     * Tests Phalcon\Http\Response :: checkNotModified()
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2021-07-07
+     */
+    public function httpResponseCheckNotModified(UnitTester $I)
+    {
+        $I->wantToTest('Http\Response - checkNotModified()');
+
+        $_SERVER['REQUEST_METHOD'] = 'GET';
+
+        $response = $this->getResponseObject();
+        $response->setContent('<p>listing</p>');
+
+        $I->assertFalse($response->checkNotModified());
+
+        $etag = 'W/"' . sha1('<p>listing</p>') . '"';
+        $I->assertEquals($etag, $response->getHeaders()->get('Etag'));
+
+        $_SERVER['HTTP_IF_NONE_MATCH'] = '"other", ' . $etag;
+
+        $response = $this->getResponseObject();
+        $response->setContent('<p>listing</p>');
+
+        $I->assertTrue($response->checkNotModified());
+        $I->assertEquals(304, $response->getStatusCode());
+
+        ob_start();
+        $response->send();
+        $actual = ob_get_clean();
+
+        $I->assertEquals('', $actual);
+
+        /**
+         * Only GET and HEAD requests
+         */
+        $_SERVER['REQUEST_METHOD'] = 'POST';
+
+        $response = $this->getResponseObject();
+        $response->setContent('<p>listing</p>');
+
+        $I->assertFalse($response->checkNotModified());
+    }
+
+    /**
+     * Tests Phalcon\Http\Response :: isNotModified() - Last-Modified
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2021-07-07
+     */
+    public function httpResponseIsNotModifiedLastModified(UnitTester $I)
+    {
+        $I->wantToTest('Http\Response - isNotModified() - Last-Modified');
+
+        $_SERVER['REQUEST_METHOD']         = 'GET';
+        $_SERVER['HTTP_IF_MODIFIED_SINCE'] = 'Tue, 01 Jun 2021 10:00:00 GMT';
+
+        $response = $this->getResponseObject();
+        $response->setLastModified(new DateTime('2021-06-01 09:00:00 UTC'));
+
+        $I->assertTrue($response->isNotModified());
+
+        $response->setLastModified(new DateTime('2021-06-01 11:00:00 UTC'));
+
+        $I->assertFalse($response->isNotModified());
+    }
+}
@@ -32,15 +32,88 @@ class SetFileToSendCest extends HttpBase
 
         $response->setFileToSend($filename);
 
-        ob_start();
-        $response->send();
-
         $expected = file_get_contents($filename);
-        $actual   = ob_get_clean();
+        $actual   = implode('', $this->getSentChunks($response));
         $I->assertEquals($expected, $actual);
 
         $I->assertTrue(
             $response->isSent()
         );
     }
+
+    /**
+     * Tests setFileToSend - range
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2021-07-07
+     */
+    public function testHttpResponseSetFileToSendRange(UnitTester $I)
+    {
+        $filename = __FILE__;
+        $contents = file_get_contents($filename);
+        $size     = strlen($contents);
+
+        $_SERVER['HTTP_RANGE'] = 'bytes=6-25';
+
+        $response = $this->getResponseObject();
+        $response->setFileToSend($filename);
+
+        $actual = implode('', $this->getSentChunks($response));
+
+        $I->assertEquals(substr($contents, 6, 20), $actual);
+        $I->assertEquals(206, $response->getStatusCode());
+
+        $headers = $response->getHeaders();
+        $I->assertEquals('bytes 6-25/' . $size, $headers->get('Content-Range'));
+        $I->assertEquals('20', $headers->get('Content-Length'));
+
+        $_SERVER['HTTP_RANGE'] = 'bytes=-10';
+
+        $response = $this->getResponseObject();
+        $response->setFileToSend($filename);
+
+        $actual = implode('', $this->getSentChunks($response));
+
+        $I->assertEquals(substr($contents, -10), $actual);
+
+        $_SERVER['HTTP_RANGE'] = 'bytes=' . ($size + 10) . '-';
+
+        $response = $this->getResponseObject();
+        $response->setFileToSend($filename);
+
+        $actual = implode('', $this->getSentChunks($response));
+
+        $I->assertEquals('', $actual);
+        $I->assertEquals(416, $response->getStatusCode());
+        $I->assertEquals(
+            'bytes */' . $size,
+            $response->getHeaders()->get('Content-Range')
+        );
+    }
+
+    /**
+     * Tests setFileToSend - offload
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2021-07-07
+     */
+    public function testHttpResponseSetFileToSendOffload(UnitTester $I)
+    {
+        $response = $this->getResponseObject();
+        $response->setFileToSend(
+            __FILE__,
+            'test.php',
+            true,
+            'X-Accel-Redirect',
+            '/protected/test.php'
+        );
+
+        $actual = implode('', $this->getSentChunks($response));
+
+        $I->assertEquals('', $actual);
+        $I->assertEquals(
+            '/protected/test.php',
+            $response->getHeaders()->get('X-Accel-Redirect')
+        );
+    }
 }
@@ -0,0 +1,89 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Test\Unit\Http\Response;
+
+use ArrayIterator;
+use Phalcon\Http\Response\Exception;
+use Phalcon\Test\Unit\Http\Helper\HttpBase;
+use UnitTester;
+
+class SetStreamedContentCest extends HttpBase
+{
+    /**
+     * Tests Phalcon\Http\Response :: setStreamedContent()
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2021-07-07
+     */
+    public function httpResponseSetStreamedContent(UnitTester $I)
+    {
+        $I->wantToTest('Http\Response - setStreamedContent()');
+
+        $response = $this->getResponseObject();
+        $response->setStreamedContent(
+            function () {
+                yield 'one,';
+                yield 'two,';
+                yield 'three';
+            }
+        );
+
+        /**
+         * Every chunk leaves the output buffer as soon as it is sent
+         */
+        $chunks = $this->getSentChunks($response);
+
+        $I->assertEquals(['one,', 'two,', 'three'], $chunks);
+        $I->assertTrue($response->isSent());
+
+        $response = $this->getResponseObject();
+        $response->setStreamedContent(new ArrayIterator(['a', 'b']));
+
+        $actual = implode('', $this->getSentChunks($response));
+
+        $I->assertEquals('ab', $actual);
+
+        $response = $this->getResponseObject();
+        $response->setStreamedContent(
+            function () {
+                echo 'echoed';
+            }
+        );
+
+        $actual = implode('', $this->getSentChunks($response));
+
+        $I->assertEquals('echoed', $actual);
+    }
+
+    /**
+     * Tests Phalcon\Http\Response :: setStreamedContent() - exception
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2021-07-07
+     */
+    public function httpResponseSetStreamedContentException(UnitTester $I)
+    {
+        $I->wantToTest('Http\Response - setStreamedContent() - exception');
+
+        $I->expectThrowable(
+            new Exception(
+                'The streamed content must be an iterable or a callable'
+            ),
+            function () {
+                $response = $this->getResponseObject();
+                $response->setStreamedContent('content');
+            }
+        );
+    }
+}
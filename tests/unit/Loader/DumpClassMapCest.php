@@ -0,0 +1,95 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Test\Unit\Loader;
+
+use Phalcon\Loader;
+use Phalcon\Test\Fixtures\Traits\LoaderTrait;
+use UnitTester;
+
+use function dataDir;
+use function outputDir;
+use function uniqid;
+
+class DumpClassMapCest
+{
+    use LoaderTrait;
+
+    /**
+     * Tests Phalcon\Loader :: dumpClassMap()
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2021-07-07
+     */
+    public function loaderDumpClassMap(UnitTester $I)
+    {
+        $I->wantToTest('Loader - dumpClassMap()');
+
+        $directory = dataDir('fixtures/Loader/Example/Namespaces/Engines/');
+        $file      = outputDir(uniqid('classmap-') . '.php');
+
+        $loader = new Loader();
+        $loader
+            ->setExtensions(['php', 'inc'])
+            ->registerNamespaces(
+                [
+                    'Example\Namespaces\Engines' => $directory,
+                ]
+            )
+        ;
+
+        $classMap = $loader->dumpClassMap($file);
+
+        $I->assertEquals(
+            $directory . 'Alcohol.inc',
+            $classMap['Example\Namespaces\Engines\Alcohol']
+        );
+        $I->assertEquals(
+            $directory . 'Gasoline.php',
+            $classMap['Example\Namespaces\Engines\Gasoline']
+        );
+        $I->seeFileFound($file);
+
+        /**
+         * Authoritative mode never checks the filesystem
+         */
+        $checked = [];
+        $loader  = new Loader();
+        $loader
+            ->registerNamespaces(
+                [
+                    'Example\Namespaces\Engines' => $directory,
+                ]
+            )
+            ->registerClassMap($file, true)
+            ->setFileCheckingCallback(
+                function ($file) use (&$checked) {
+                    $checked[] = $file;
+
+                    return false;
+                }
+            )
+        ;
+
+        $I->assertEquals($classMap, $loader->getClasses());
+        $I->assertFalse($loader->autoLoad('Example\Namespaces\Engines\Unknown'));
+        $I->assertEquals([], $checked);
+
+        $loader->setAuthoritative(false);
+
+        $I->assertFalse($loader->autoLoad('Example\Namespaces\Engines\Unknown'));
+        $I->assertEquals([$directory . 'Unknown.php'], $checked);
+
+        $I->safeDeleteFile($file);
+    }
+}
@@ -0,0 +1,92 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * (c) Phalcon Team <team@phalcon.io>
+ *
+ * For the full copyright and license information, please view the LICENSE.txt
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Test\Unit\Logger\Adapter\Stream;
+
+use DateTimeImmutable;
+use Phalcon\Logger;
+use Phalcon\Logger\Adapter\Stream;
+use Phalcon\Logger\Item;
+use UnitTester;
+
+use function logsDir;
+
+class FlushCest
+{
+    /**
+     * Tests Phalcon\Logger\Adapter\Stream :: flush()
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2021-07-07
+     */
+    public function loggerAdapterStreamFlush(UnitTester $I)
+    {
+        $I->wantToTest('Logger\Adapter\Stream - flush()');
+
+        $fileName   = $I->getNewFileName('log', 'log');
+        $outputPath = logsDir();
+        $time       = new DateTimeImmutable('now');
+        $adapter    = new Stream(
+            $outputPath . $fileName,
+            [
+                'bufferSize' => 3,
+            ]
+        );
+
+        $adapter->process(
+            new Item('Message 1', 'debug', Logger::DEBUG, $time)
+        );
+        $adapter->process(
+            new Item('Message 2', 'debug', Logger::DEBUG, $time)
+        );
+
+        /**
+         * Nothing written until the buffer is full
+         */
+        $I->dontSeeFileFound($fileName, $outputPath);
+
+        $adapter->process(
+            new Item('Message 3', 'debug', Logger::DEBUG, $time)
+        );
+
+        $I->amInPath($outputPath);
+        $I->openFile($fileName);
+        $I->seeInThisFile('Message 1');
+        $I->seeInThisFile('Message 3');
+
+        $adapter->process(
+            new Item('Message 4', 'debug', Logger::DEBUG, $time)
+        );
+
+        $I->openFile($fileName);
+        $I->dontSeeInThisFile('Message 4');
+
+        $I->assertTrue($adapter->flush());
+
+        $I->openFile($fileName);
+        $I->seeInThisFile('Message 4');
+
+        /**
+         * close() writes what is left in the buffer
+         */
+        $adapter->process(
+            new Item('Message 5', 'debug', Logger::DEBUG, $time)
+        );
+        $adapter->close();
+
+        $I->openFile($fileName);
+        $I->seeInThisFile('Message 5');
+
+        $I->safeDeleteFile($outputPath . $fileName);
+    }
+}
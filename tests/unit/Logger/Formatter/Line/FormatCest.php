@@ -14,6 +14,7 @@ declare(strict_types=1);
 namespace Phalcon\Test\Unit\Logger\Formatter\Line;
 
 use DateTimeImmutable;
+use DateTimeZone;
 use Phalcon\Logger;
 use Phalcon\Logger\Formatter\Line;
 use Phalcon\Logger\Item;
@@ -93,4 +94,100 @@ class FormatCest
         $I->assertGreaterThan(0, (int) $parts[0]);
         $I->assertGreaterThan(0, (int) $parts[1]);
     }
+
+    /**
+     * Tests Phalcon\Logger\Formatter\Line :: format() - context
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2021-07-07
+     */
+    public function loggerFormatterLineFormatContext(UnitTester $I)
+    {
+        $I->wantToTest('Logger\Formatter\Line - format() - context');
+
+        $formatter = new Line('%server% %level%: %message% (%unknown%) 100%');
+        $time      = new DateTimeImmutable("now");
+        $item      = new Item(
+            'log %server% message',
+            'debug',
+            Logger::DEBUG,
+            $time,
+            [
+                'server' => 'web-1',
+            ]
+        );
+
+        $expected = 'web-1 debug: log %server% message (%unknown%) 100%';
+        $actual   = $formatter->format($item);
+        $I->assertEquals($expected, $actual);
+
+        /**
+         * The format is split again when changed
+         */
+        $formatter->setFormat('[%level%] %message%');
+
+        $expected = '[debug] log %server% message';
+        $actual   = $formatter->format($item);
+        $I->assertEquals($expected, $actual);
+    }
+
+    /**
+     * Tests Phalcon\Logger\Formatter\Line :: format() - context placeholders
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2021-07-07
+     */
+    public function loggerFormatterLineFormatContextPlaceholders(UnitTester $I)
+    {
+        $I->wantToTest('Logger\Formatter\Line - format() - context placeholders');
+
+        $formatter = new Line('[%user:id%][%request id%] %message%');
+        $time      = new DateTimeImmutable("now");
+        $item      = new Item(
+            'log message',
+            'debug',
+            Logger::DEBUG,
+            $time,
+            [
+                'user:id'    => 42,
+                'request id' => 'abc',
+            ]
+        );
+
+        $expected = '[42][abc] log message';
+        $actual   = $formatter->format($item);
+        $I->assertEquals($expected, $actual);
+    }
+
+    /**
+     * Tests Phalcon\Logger\Formatter\Line :: format() - date timezone
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2021-07-07
+     */
+    public function loggerFormatterLineFormatDateTimezone(UnitTester $I)
+    {
+        $I->wantToTest('Logger\Formatter\Line - format() - date timezone');
+
+        $formatter = new Line('%date%', 'Y-m-d H:i:s e');
+        $time      = new DateTimeImmutable('2021-01-01 12:00:00', new DateTimeZone('UTC'));
+
+        $item     = new Item('log message', 'debug', Logger::DEBUG, $time);
+        $expected = '2021-01-01 12:00:00 UTC';
+        $actual   = $formatter->format($item);
+        $I->assertEquals($expected, $actual);
+
+        /**
+         * Same second and offset, another timezone
+         */
+        $item     = new Item(
+            'log message',
+            'debug',
+            Logger::DEBUG,
+            $time->setTimezone(new DateTimeZone('Africa/Abidjan'))
+        );
+        $expected = '2021-01-01 12:00:00 Africa/Abidjan';
+        $actual   = $formatter->format($item);
+        $I->assertEquals($expected, $actual);
+    }
 }
@@ -0,0 +1,94 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * For the full copyright and license information, please view the LICENSE.md
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Test\Unit\Security\JWT\Signer\Ecdsa;
+
+use Phalcon\Security\JWT\Builder;
+use Phalcon\Security\JWT\Signer\Ecdsa;
+use Phalcon\Security\JWT\Validator;
+use UnitTester;
+
+use function openssl_pkey_export;
+use function openssl_pkey_get_details;
+use function openssl_pkey_new;
+use function strlen;
+
+class VerifyCest
+{
+    /**
+     * Unit Tests Phalcon\Security\JWT\Signer\Ecdsa :: verify()
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2021-07-07
+     */
+    public function securityJWTSignerEcdsaVerify(UnitTester $I)
+    {
+        $I->wantToTest('Security\JWT\Signer\Ecdsa - verify()');
+
+        [$private, $public] = $this->getKeys();
+
+        $signer  = new Ecdsa();
+        $payload = 'test payload';
+
+        $I->assertEquals('ES256', $signer->getAlgHeader());
+
+        /**
+         * JWT uses the concatenated R and S values, not DER
+         */
+        $signature = $signer->sign($payload, $private);
+        $I->assertEquals(64, strlen($signature));
+
+        $I->assertTrue($signer->verify($signature, $payload, $public));
+        $I->assertFalse($signer->verify($signature, 'other payload', $public));
+        $I->assertFalse($signer->verify('short', $payload, $public));
+    }
+
+    /**
+     * Unit Tests Phalcon\Security\JWT\Signer\Ecdsa :: verify() - token
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2021-07-07
+     */
+    public function securityJWTSignerEcdsaVerifyToken(UnitTester $I)
+    {
+        $I->wantToTest('Security\JWT\Signer\Ecdsa - verify() - token');
+
+        [$private, $public] = $this->getKeys();
+
+        $signer = new Ecdsa();
+        $token  = (new Builder($signer))
+            ->setExpirationTime(strtotime('+1 day'))
+            ->setSubject('Mary had a little lamb')
+            ->setPassphrase($private)
+            ->getToken()
+        ;
+
+        $validator = new Validator($token);
+        $I->assertInstanceOf(
+            Validator::class,
+            $validator->validateSignature($signer, $public)
+        );
+    }
+
+    private function getKeys(): array
+    {
+        $key = openssl_pkey_new(
+            [
+                'curve_name'       => 'prime256v1',
+                'private_key_type' => OPENSSL_KEYTYPE_EC,
+            ]
+        );
+
+        openssl_pkey_export($key, $private);
+
+        return [$private, openssl_pkey_get_details($key)['key']];
+    }
+}
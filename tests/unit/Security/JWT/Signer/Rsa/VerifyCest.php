@@ -0,0 +1,89 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * For the full copyright and license information, please view the LICENSE.md
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Test\Unit\Security\JWT\Signer\Rsa;
+
+use Phalcon\Security\JWT\Builder;
+use Phalcon\Security\JWT\Signer\Rsa;
+use Phalcon\Security\JWT\Validator;
+use UnitTester;
+
+use function openssl_pkey_export;
+use function openssl_pkey_get_details;
+use function openssl_pkey_new;
+
+class VerifyCest
+{
+    /**
+     * Unit Tests Phalcon\Security\JWT\Signer\Rsa :: verify()
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2021-07-07
+     */
+    public function securityJWTSignerRsaVerify(UnitTester $I)
+    {
+        $I->wantToTest('Security\JWT\Signer\Rsa - verify()');
+
+        [$private, $public] = $this->getKeys();
+
+        $signer  = new Rsa('sha384');
+        $payload = 'test payload';
+
+        $I->assertEquals('RS384', $signer->getAlgHeader());
+
+        $signature = $signer->sign($payload, $private);
+        $I->assertTrue($signer->verify($signature, $payload, $public));
+        $I->assertFalse($signer->verify($signature, 'other payload', $public));
+    }
+
+    /**
+     * Unit Tests Phalcon\Security\JWT\Signer\Rsa :: verify() - token
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2021-07-07
+     */
+    public function securityJWTSignerRsaVerifyToken(UnitTester $I)
+    {
+        $I->wantToTest('Security\JWT\Signer\Rsa - verify() - token');
+
+        [$private, $public] = $this->getKeys();
+
+        $signer = new Rsa();
+        $token  = (new Builder($signer))
+            ->setExpirationTime(strtotime('+1 day'))
+            ->setSubject('Mary had a little lamb')
+            ->setPassphrase($private)
+            ->getToken()
+        ;
+
+        $I->assertEquals('RS256', $token->getHeaders()->get('alg'));
+
+        $validator = new Validator($token);
+        $I->assertInstanceOf(
+            Validator::class,
+            $validator->validateSignature($signer, $public)
+        );
+    }
+
+    private function getKeys(): array
+    {
+        $key = openssl_pkey_new(
+            [
+                'private_key_bits' => 2048,
+                'private_key_type' => OPENSSL_KEYTYPE_RSA,
+            ]
+        );
+
+        openssl_pkey_export($key, $private);
+
+        return [$private, openssl_pkey_get_details($key)['key']];
+    }
+}
@@ -0,0 +1,71 @@
+<?php
+
+/**
+ * This file is part of the Phalcon Framework.
+ *
+ * For the full copyright and license information, please view the LICENSE.md
+ * file that was distributed with this source code.
+ */
+
+declare(strict_types=1);
+
+namespace Phalcon\Test\Unit\Security\JWT\Validator;
+
+use Phalcon\Security\JWT\Builder;
+use Phalcon\Security\JWT\Exceptions\ValidatorException;
+use Phalcon\Security\JWT\Signer\Hmac;
+use Phalcon\Security\JWT\Validator;
+use UnitTester;
+
+class SetVerifiedCacheSizeCest
+{
+    public function _after(UnitTester $I)
+    {
+        Validator::setVerifiedCacheSize(0);
+    }
+
+    /**
+     * Unit Tests Phalcon\Security\JWT\Validator :: setVerifiedCacheSize()
+     *
+     * @author Phalcon Team <team@phalcon.io>
+     * @since  2021-07-07
+     */
+    public function securityJWTValidatorSetVerifiedCacheSize(UnitTester $I)
+    {
+        $I->wantToTest('Security\JWT\Validator - setVerifiedCacheSize()');
+
+        Validator::setVerifiedCacheSize(10);
+
+        $signer     = new Hmac();
+        $passphrase = '&vsJBETaizP3A3VX&TPMJUqi48fJEgN7';
+        $token      = (new Builder($signer))
+            ->setExpirationTime(strtotime('+1 day'))
+            ->setNotBefore(strtotime('-1 day'))
+            ->setSubject('Mary had a little lamb')
+            ->setPassphrase($passphrase)
+            ->getToken()
+        ;
+
+        $validator = new Validator($token);
+        $I->assertInstanceOf(
+            Validator::class,
+            $validator->validateSignature($signer, $passphrase)
+        );
+        $I->assertInstanceOf(
+            Validator::class,
+            $validator->validateSignature($signer, $passphrase)
+        );
+
+        /**
+         * A cached token is not accepted with another passphrase
+         */
+        $I->expectThrowable(
+            new ValidatorException(
+                'Validation: the signature does not match'
+            ),
+            function () use ($validator, $signer) {
+                $validator->validateSignature($signer, '123456');
+            }
+        );
+    }
+}